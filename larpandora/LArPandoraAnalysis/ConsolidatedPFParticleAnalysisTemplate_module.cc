@@ -12,6 +12,11 @@
 #include "lardataobj/RecoBase/Track.h"
 
 #include <string>
+#include <vector>
+
+namespace larpandoraobj {
+  class PFParticleMetadata;
+}
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -23,10 +28,34 @@ namespace lar_pandora {
   class ConsolidatedPFParticleAnalysisTemplate : public art::EDAnalyzer {
   public:
     typedef art::Handle<std::vector<recob::PFParticle>> PFParticleHandle;
-    typedef std::map<size_t, art::Ptr<recob::PFParticle>> PFParticleIdMap;
     typedef std::vector<art::Ptr<recob::PFParticle>> PFParticleVector;
     typedef std::vector<art::Ptr<recob::Track>> TrackVector;
     typedef std::vector<art::Ptr<recob::Shower>> ShowerVector;
+    typedef std::vector<art::Ptr<larpandoraobj::PFParticleMetadata>> MetadataVector;
+
+    /**
+     *  @brief  PFParticleIndex class, the PFParticles of an event and their associated objects
+     *
+     *  The associations are read once per event into vectors indexed by PFParticle key, so that
+     *  navigating the hierarchy and finding associated objects are simple vector lookups.
+     */
+    class PFParticleIndex {
+    public:
+      /**
+       *  @brief  Get the PFParticle with a given ID
+       *
+       *  @param  id the PFParticle ID, as returned by recob::PFParticle::Self
+       *
+       *  @return the PFParticle, throwing if there is no PFParticle with this ID
+       */
+      const art::Ptr<recob::PFParticle>& GetParticle(const size_t id) const;
+
+      PFParticleVector m_particles;           ///< The PFParticles, indexed by key
+      std::vector<size_t> m_idToKey;          ///< The key of the PFParticle with each ID
+      std::vector<MetadataVector> m_metadata; ///< The metadata by key, only when printing scores
+      std::vector<TrackVector> m_tracks;      ///< The tracks of each PFParticle, by key
+      std::vector<ShowerVector> m_showers;    ///< The showers of each PFParticle, by key
+    };
 
     /**
      *  @brief  Constructor
@@ -51,52 +80,52 @@ namespace lar_pandora {
 
   private:
     /**
-     *  @brief  Produce a mapping from PFParticle ID to the art ptr to the PFParticle itself for fast navigation
+     *  @brief  Index the PFParticles by ID and read their metadata, tracks and showers for fast navigation
      *
+     *  @param  evt the art event to analyze
      *  @param  pfParticleHandle the handle for the PFParticle collection
-     *  @param  pfParticleMap the mapping from ID to PFParticle
+     *  @param  pfParticleIndex the index to fill
      */
-    void GetPFParticleIdMap(const PFParticleHandle& pfParticleHandle,
-                            PFParticleIdMap& pfParticleMap);
+    void BuildPFParticleIndex(const art::Event& evt,
+                              const PFParticleHandle& pfParticleHandle,
+                              PFParticleIndex& pfParticleIndex) const;
 
     /**
      * @brief Print out scores in PFParticleMetadata
      *
-     * @param evt the art event to analyze
-     * @param pfParticleHandle the handle for the PFParticle collection
+     * @param pfParticleIndex the index of the PFParticles and their metadata
      */
-    void PrintOutScores(const art::Event& evt, const PFParticleHandle& pfParticleHandle) const;
+    void PrintOutScores(const PFParticleIndex& pfParticleIndex) const;
 
     /**
-     *  @brief  Produce a mapping from PFParticle ID to the art ptr to the PFParticle itself for fast navigation
+     *  @brief  Collect the final-state PFParticles reconstructed under each hypothesis
      *
-     *  @param  pfParticleMap the mapping from ID to PFParticle
+     *  @param  pfParticleIndex the index of the PFParticles
      *  @param  crParticles a vector to hold the top-level PFParticles reconstructed under the cosmic hypothesis
      *  @param  nuParticles a vector to hold the final-states of the reconstruced neutrino
      */
-    void GetFinalStatePFParticleVectors(const PFParticleIdMap& pfParticleMap,
+    void GetFinalStatePFParticleVectors(const PFParticleIndex& pfParticleIndex,
                                         PFParticleVector& crParticles,
-                                        PFParticleVector& nuParticles);
+                                        PFParticleVector& nuParticles) const;
 
     /**
      *  @brief  Collect associated tracks and showers to particles in an input particle vector
      *
      *  @param  particles a vector holding PFParticles from which to find the associated tracks and showers
-     *  @param  pfParticleHandle the handle for the PFParticle collection
-     *  @param  evt the art event to analyze
+     *  @param  pfParticleIndex the index of the PFParticles and their tracks and showers
      *  @param  tracks a vector to hold the associated tracks
      *  @param  showers a vector to hold the associated showers
      */
     void CollectTracksAndShowers(const PFParticleVector& particles,
-                                 const PFParticleHandle& pfParticleHandle,
-                                 const art::Event& evt,
+                                 const PFParticleIndex& pfParticleIndex,
                                  TrackVector& tracks,
-                                 ShowerVector& showers);
+                                 ShowerVector& showers) const;
 
     std::string m_pandoraLabel; ///< The label for the pandora producer
     std::string m_trackLabel;   ///< The label for the track producer from PFParticles
     std::string m_showerLabel;  ///< The label for the shower producer from PFParticles
     bool m_printOutScores; ///< Option to investigate the associations to scores for PFParticles
+    std::vector<std::string> m_scoreNames; ///< The metadata scores to print (empty for all)
   };
 
   DEFINE_ART_MODULE(ConsolidatedPFParticleAnalysisTemplate)
@@ -119,7 +148,10 @@ namespace lar_pandora {
 
 #include "Pandora/PdgTable.h"
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
+#include <memory>
 
 namespace lar_pandora {
 
@@ -138,6 +170,7 @@ namespace lar_pandora {
     m_trackLabel = pset.get<std::string>("TrackLabel");
     m_showerLabel = pset.get<std::string>("ShowerLabel");
     m_printOutScores = pset.get<bool>("PrintOutScores", true);
+    m_scoreNames = pset.get<std::vector<std::string>>("ScoreNames", {});
   }
 
   //------------------------------------------------------------------------------------------------------------------------------------------
@@ -154,19 +187,19 @@ namespace lar_pandora {
       return;
     }
 
-    // Produce a map of the PFParticle IDs for fast navigation through the hierarchy
-    PFParticleIdMap pfParticleMap;
-    this->GetPFParticleIdMap(pfParticleHandle, pfParticleMap);
+    // Index the PFParticles by ID, with their associated objects, for fast navigation through the hierarchy
+    PFParticleIndex pfParticleIndex;
+    this->BuildPFParticleIndex(evt, pfParticleHandle, pfParticleIndex);
 
     /// Investigate scores associated as larpandoraobject::metadata for the PFParticles
-    if (m_printOutScores) this->PrintOutScores(evt, pfParticleHandle);
+    if (m_printOutScores) this->PrintOutScores(pfParticleIndex);
 
     // Produce two PFParticle vectors containing final-state particles:
     // 1. Particles identified as cosmic-rays - recontructed under cosmic-hypothesis
     // 2. Daughters of the neutrino PFParticle - reconstructed under the neutrino hypothesis
     std::vector<art::Ptr<recob::PFParticle>> crParticles;
     std::vector<art::Ptr<recob::PFParticle>> nuParticles;
-    this->GetFinalStatePFParticleVectors(pfParticleMap, crParticles, nuParticles);
+    this->GetFinalStatePFParticleVectors(pfParticleIndex, crParticles, nuParticles);
 
     // Use as required!
     // -----------------------------
@@ -175,7 +208,7 @@ namespace lar_pandora {
     // These are the vectors to hold the tracks and showers for the final-states of the reconstructed neutrino
     std::vector<art::Ptr<recob::Track>> tracks;
     std::vector<art::Ptr<recob::Shower>> showers;
-    this->CollectTracksAndShowers(nuParticles, pfParticleHandle, evt, tracks, showers);
+    this->CollectTracksAndShowers(nuParticles, pfParticleIndex, tracks, showers);
 
     // Print a summary of the consolidated event
     std::cout << "Consolidated event summary:" << std::endl;
@@ -189,45 +222,76 @@ namespace lar_pandora {
 
   //------------------------------------------------------------------------------------------------------------------------------------------
 
-  void ConsolidatedPFParticleAnalysisTemplate::GetPFParticleIdMap(
+  void ConsolidatedPFParticleAnalysisTemplate::BuildPFParticleIndex(
+    const art::Event& evt,
     const PFParticleHandle& pfParticleHandle,
-    PFParticleIdMap& pfParticleMap)
+    PFParticleIndex& pfParticleIndex) const
   {
-    for (unsigned int i = 0; i < pfParticleHandle->size(); ++i) {
+    const size_t nParticles(pfParticleHandle->size());
+    const size_t invalidKey(std::numeric_limits<size_t>::max());
+
+    // Each association is read once here, rather than with a FindManyP for every use; the metadata is only needed to print the scores
+    const std::unique_ptr<art::FindManyP<larpandoraobj::PFParticleMetadata>> pPfPartToMetadataAssoc(
+      m_printOutScores ? std::make_unique<art::FindManyP<larpandoraobj::PFParticleMetadata>>(
+                           pfParticleHandle, evt, m_pandoraLabel) :
+                         nullptr);
+    art::FindManyP<recob::Track> pfPartToTrackAssoc(pfParticleHandle, evt, m_trackLabel);
+    art::FindManyP<recob::Shower> pfPartToShowerAssoc(pfParticleHandle, evt, m_showerLabel);
+
+    pfParticleIndex.m_particles.reserve(nParticles);
+    if (pPfPartToMetadataAssoc) pfParticleIndex.m_metadata.reserve(nParticles);
+    pfParticleIndex.m_tracks.reserve(nParticles);
+    pfParticleIndex.m_showers.reserve(nParticles);
+
+    for (size_t i = 0; i < nParticles; ++i) {
       const art::Ptr<recob::PFParticle> pParticle(pfParticleHandle, i);
-      if (!pfParticleMap.insert(PFParticleIdMap::value_type(pParticle->Self(), pParticle)).second) {
+      const size_t id(pParticle->Self());
+
+      // ATTN Pandora numbers the PFParticles from zero, so the ID to key lookup can be a vector
+      if (id >= pfParticleIndex.m_idToKey.size())
+        pfParticleIndex.m_idToKey.resize(std::max(id + 1, nParticles), invalidKey);
+
+      if (invalidKey != pfParticleIndex.m_idToKey[id]) {
         throw cet::exception("ConsolidatedPFParticleAnalysisTemplate")
           << "  Unable to get PFParticle ID map, the input PFParticle collection has repeat IDs!";
       }
+
+      pfParticleIndex.m_idToKey[id] = i;
+      pfParticleIndex.m_particles.push_back(pParticle);
+      if (pPfPartToMetadataAssoc)
+        pfParticleIndex.m_metadata.push_back(pPfPartToMetadataAssoc->at(i));
+      pfParticleIndex.m_tracks.push_back(pfPartToTrackAssoc.at(i));
+      pfParticleIndex.m_showers.push_back(pfPartToShowerAssoc.at(i));
     }
   }
 
   //------------------------------------------------------------------------------------------------------------------------------------------
 
   void ConsolidatedPFParticleAnalysisTemplate::PrintOutScores(
-    const art::Event& evt,
-    const PFParticleHandle& pfParticleHandle) const
+    const PFParticleIndex& pfParticleIndex) const
   {
-    // Get the associations between PFParticles and larpandoraobj::PFParticleMetadata
-    art::FindManyP<larpandoraobj::PFParticleMetadata> pfPartToMetadataAssoc(
-      pfParticleHandle, evt, m_pandoraLabel);
-
-    for (unsigned int i = 0; i < pfParticleHandle->size(); ++i) {
-      const std::vector<art::Ptr<larpandoraobj::PFParticleMetadata>>& pfParticleMetadataList(
-        pfPartToMetadataAssoc.at(i));
-      if (!pfParticleMetadataList.empty()) {
-        const art::Ptr<recob::PFParticle> pParticle(pfParticleHandle, i);
-        for (unsigned int j = 0; j < pfParticleMetadataList.size(); ++j) {
-          const art::Ptr<larpandoraobj::PFParticleMetadata>& pfParticleMetadata(
-            pfParticleMetadataList.at(j));
-          const larpandoraobj::PFParticleMetadata::PropertiesMap& pfParticlePropertiesMap(
-            pfParticleMetadata->GetPropertiesMap());
-          if (!pfParticlePropertiesMap.empty())
-            std::cout << " Found PFParticle " << pParticle->Self() << " with: " << std::endl;
-          for (larpandoraobj::PFParticleMetadata::PropertiesMap::const_iterator it =
-                 pfParticlePropertiesMap.begin();
-               it != pfParticlePropertiesMap.end();
-               ++it)
+    for (size_t i = 0; i < pfParticleIndex.m_particles.size(); ++i) {
+      const art::Ptr<recob::PFParticle>& pParticle(pfParticleIndex.m_particles[i]);
+
+      for (const art::Ptr<larpandoraobj::PFParticleMetadata>& pfParticleMetadata :
+           pfParticleIndex.m_metadata[i]) {
+        const larpandoraobj::PFParticleMetadata::PropertiesMap& pfParticlePropertiesMap(
+          pfParticleMetadata->GetPropertiesMap());
+        if (pfParticlePropertiesMap.empty()) continue;
+
+        std::cout << " Found PFParticle " << pParticle->Self() << " with: " << std::endl;
+
+        if (m_scoreNames.empty()) {
+          for (const auto& property : pfParticlePropertiesMap)
+            std::cout << "  - " << property.first << " = " << property.second << std::endl;
+
+          continue;
+        }
+
+        // Look up only the requested scores, rather than walking every properties map
+        for (const std::string& scoreName : m_scoreNames) {
+          const auto it(pfParticlePropertiesMap.find(scoreName));
+          if (pfParticlePropertiesMap.end() != it)
             std::cout << "  - " << it->first << " = " << it->second << std::endl;
         }
       }
@@ -236,15 +300,24 @@ namespace lar_pandora {
 
   //------------------------------------------------------------------------------------------------------------------------------------------
 
+  const art::Ptr<recob::PFParticle>&
+  ConsolidatedPFParticleAnalysisTemplate::PFParticleIndex::GetParticle(const size_t id) const
+  {
+    if ((id >= m_idToKey.size()) || (m_idToKey[id] >= m_particles.size()))
+      throw cet::exception("ConsolidatedPFParticleAnalysisTemplate")
+        << "  Invalid PFParticle collection!";
+
+    return m_particles[m_idToKey[id]];
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
   void ConsolidatedPFParticleAnalysisTemplate::GetFinalStatePFParticleVectors(
-    const PFParticleIdMap& pfParticleMap,
+    const PFParticleIndex& pfParticleIndex,
     PFParticleVector& crParticles,
-    PFParticleVector& nuParticles)
+    PFParticleVector& nuParticles) const
   {
-    for (PFParticleIdMap::const_iterator it = pfParticleMap.begin(); it != pfParticleMap.end();
-         ++it) {
-      const art::Ptr<recob::PFParticle> pParticle(it->second);
-
+    for (const art::Ptr<recob::PFParticle>& pParticle : pfParticleIndex.m_particles) {
       // Only look for primary particles
       if (!pParticle->IsPrimary()) continue;
 
@@ -267,13 +340,8 @@ namespace lar_pandora {
       }
 
       // Add the daughters of the neutrino PFParticle to the nuPFParticles vector
-      for (const size_t daughterId : pParticle->Daughters()) {
-        if (pfParticleMap.find(daughterId) == pfParticleMap.end())
-          throw cet::exception("ConsolidatedPFParticleAnalysisTemplate")
-            << "  Invalid PFParticle collection!";
-
-        nuParticles.push_back(pfParticleMap.at(daughterId));
-      }
+      for (const size_t daughterId : pParticle->Daughters())
+        nuParticles.push_back(pfParticleIndex.GetParticle(daughterId));
     }
   }
 
@@ -281,20 +349,13 @@ namespace lar_pandora {
 
   void ConsolidatedPFParticleAnalysisTemplate::CollectTracksAndShowers(
     const PFParticleVector& particles,
-    const PFParticleHandle& pfParticleHandle,
-    const art::Event& evt,
+    const PFParticleIndex& pfParticleIndex,
     TrackVector& tracks,
-    ShowerVector& showers)
+    ShowerVector& showers) const
   {
-    // Get the associations between PFParticles and tracks/showers from the event
-    art::FindManyP<recob::Track> pfPartToTrackAssoc(pfParticleHandle, evt, m_trackLabel);
-    art::FindManyP<recob::Shower> pfPartToShowerAssoc(pfParticleHandle, evt, m_showerLabel);
-
     for (const art::Ptr<recob::PFParticle>& pParticle : particles) {
-      const std::vector<art::Ptr<recob::Track>> associatedTracks(
-        pfPartToTrackAssoc.at(pParticle.key()));
-      const std::vector<art::Ptr<recob::Shower>> associatedShowers(
-        pfPartToShowerAssoc.at(pParticle.key()));
+      const TrackVector& associatedTracks(pfParticleIndex.m_tracks.at(pParticle.key()));
+      const ShowerVector& associatedShowers(pfParticleIndex.m_showers.at(pParticle.key()));
       const unsigned int nTracks(associatedTracks.size());
       const unsigned int nShowers(associatedShowers.size());
 
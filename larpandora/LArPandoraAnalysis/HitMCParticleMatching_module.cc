@@ -0,0 +1,159 @@
+/**
+ *  @file   larpandora/LArPandoraAnalysis/HitMCParticleMatching_module.cc
+ *
+ *  @brief  Producer module storing the truth matching of hits, to be shared by analysis modules
+ *
+ */
+
+#include "art/Framework/Core/EDProducer.h"
+#include "art/Framework/Core/ModuleMacros.h"
+#include "art/Framework/Principal/Event.h"
+#include "canvas/Persistency/Common/Assns.h"
+#include "cetlib_except/exception.h"
+#include "fhiclcpp/ParameterSet.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+#include "lardataobj/AnalysisBase/BackTrackerMatchingData.h"
+#include "lardataobj/RecoBase/Hit.h"
+#include "nusimdata/SimulationBase/MCParticle.h"
+
+#include "larpandora/LArPandoraInterface/LArPandoraHelper.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace lar_pandora {
+
+  /**
+ *  @brief  HitMCParticleMatching class
+ *
+ *  Matches each hit to the true particles depositing energy in it, using the SimChannels, and
+ *  stores the result as associations between hits and MCParticles with the matching fractions.
+ *  Analysis modules that set their TruthMatchingModule to the label of this module read these
+ *  associations instead of each repeating the matching.
+ */
+  class HitMCParticleMatching : public art::EDProducer {
+  public:
+    typedef art::Assns<recob::Hit, simb::MCParticle, anab::BackTrackerHitMatchingData>
+      HitParticleAssociations;
+
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  pset
+     */
+    explicit HitMCParticleMatching(fhicl::ParameterSet const& pset);
+
+    HitMCParticleMatching(HitMCParticleMatching const&) = delete;
+    HitMCParticleMatching(HitMCParticleMatching&&) = delete;
+    HitMCParticleMatching& operator=(HitMCParticleMatching const&) = delete;
+    HitMCParticleMatching& operator=(HitMCParticleMatching&&) = delete;
+
+    void produce(art::Event& evt) override;
+
+  private:
+    std::string m_hitfinderLabel;   ///< The label of the hits to match
+    std::string m_geantModuleLabel; ///< The label of the SimChannels and MCParticles
+  };
+
+  DEFINE_ART_MODULE(HitMCParticleMatching)
+
+} // namespace lar_pandora
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+// implementation follows
+
+namespace lar_pandora {
+
+  HitMCParticleMatching::HitMCParticleMatching(fhicl::ParameterSet const& pset)
+    : EDProducer{pset}
+    , m_hitfinderLabel(pset.get<std::string>("HitFinderModule"))
+    , m_geantModuleLabel(pset.get<std::string>("GeantModule", "largeant"))
+  {
+    produces<HitParticleAssociations>();
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  void HitMCParticleMatching::produce(art::Event& evt)
+  {
+    auto outputAssociations = std::make_unique<HitParticleAssociations>();
+
+    HitVector hitVector;
+    SimChannelVector simChannelVector;
+    MCTruthToMCParticles truthToParticles;
+    MCParticlesToMCTruth particlesToTruth;
+    HitsToTrackIDEs hitsToTrackIDEs;
+
+    bool areSimChannelsValid(false);
+    LArPandoraHelper::CollectHits(evt, m_hitfinderLabel, hitVector);
+    LArPandoraHelper::CollectSimChannels(
+      evt, m_geantModuleLabel, simChannelVector, areSimChannelsValid);
+
+    if (!areSimChannelsValid) {
+      mf::LogWarning("LArPandora") << " HitMCParticleMatching::produce - no sim channels found, "
+                                      "no hits will be matched "
+                                   << std::endl;
+      evt.put(std::move(outputAssociations));
+      return;
+    }
+
+    LArPandoraHelper::CollectMCParticles(
+      evt, m_geantModuleLabel, truthToParticles, particlesToTruth);
+    LArPandoraHelper::BuildMCParticleHitMaps(evt, hitVector, simChannelVector, hitsToTrackIDEs);
+
+    MCParticleMap particleMap;
+    for (const auto& particleToTruth : particlesToTruth)
+      particleMap[particleToTruth.first->TrackId()] = particleToTruth.first;
+
+    // Iterate in hit order so that the associations are grouped by hit
+    for (const art::Ptr<recob::Hit>& hit : hitVector) {
+      const HitsToTrackIDEs::const_iterator iter = hitsToTrackIDEs.find(hit);
+      if (hitsToTrackIDEs.end() == iter) continue;
+
+      const TrackIDEVector& trackCollection = iter->second;
+
+      int bestTrackID(-1);
+      float totalElectrons(0.f);
+      float maxEnergyFrac(0.f), maxElectrons(0.f);
+      for (const sim::TrackIDE& trackIDE : trackCollection) {
+        totalElectrons += trackIDE.numElectrons;
+        maxElectrons = std::max(maxElectrons, trackIDE.numElectrons);
+
+        if (trackIDE.energyFrac > maxEnergyFrac) {
+          maxEnergyFrac = trackIDE.energyFrac;
+          bestTrackID = std::abs(trackIDE.trackID);
+        }
+      }
+
+      // ATTN: As in BuildMCParticleHitMaps, only the best matched track ID must have an MC Particle
+      if ((bestTrackID >= 0) && (particleMap.end() == particleMap.find(bestTrackID)))
+        throw cet::exception("LArPandora") << " HitMCParticleMatching::produce --- "
+                                              "Found a track ID without an MC Particle ";
+
+      for (const sim::TrackIDE& trackIDE : trackCollection) {
+        // ATTN: Track IDs of secondary deposits can be negative, as in BuildMCParticleHitMaps
+        const MCParticleMap::const_iterator pIter = particleMap.find(std::abs(trackIDE.trackID));
+        if (particleMap.end() == pIter) continue;
+
+        anab::BackTrackerHitMatchingData matchingData;
+        matchingData.ideFraction = trackIDE.energyFrac;
+        matchingData.isMaxIDE = (trackIDE.energyFrac == maxEnergyFrac);
+        matchingData.ideNFraction =
+          (totalElectrons > 0.f) ? trackIDE.numElectrons / totalElectrons : 0.f;
+        matchingData.isMaxIDEN = (trackIDE.numElectrons == maxElectrons);
+        matchingData.numElectrons = trackIDE.numElectrons;
+        matchingData.energy = trackIDE.energy;
+
+        outputAssociations->addSingle(hit, pIter->second, matchingData);
+      }
+    }
+
+    evt.put(std::move(outputAssociations));
+  }
+
+} // namespace lar_pandora
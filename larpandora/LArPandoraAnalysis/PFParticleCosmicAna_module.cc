@@ -11,14 +11,20 @@
 
 #include "TTree.h"
 
+#include <map>
 #include <string>
 
+class TH1F;
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 namespace lar_pandora {
 
   /**
  *  @brief  PFParticleCosmicAna class
+ *
+ *  With EnableTruth set to false, no truth information is read and only the reconstruction tree
+ *  (and, optionally, the summary histograms) are written, so that the module can run on data.
  */
   class PFParticleCosmicAna : public art::EDAnalyzer {
   public:
@@ -40,16 +46,18 @@ namespace lar_pandora {
     void reconfigure(fhicl::ParameterSet const& pset);
 
   private:
+    typedef std::map<art::Ptr<recob::PFParticle>, float> PFParticlesToCosmicScores;
+
     /**
      *  @brief Fill event-level variables using input maps between reconstructed objects
      *
      *  @param  recoParticlesToHits  mapping from particles to hits
      *  @param  recoParticlesToTracks  mapping from particles to tracks
-     *  @param  recoTracksToCosmicTags  mapping from tracks to cosmic tags
+     *  @param  recoParticlesToCosmicScores  mapping from particles to cosmic scores
      */
     void FillRecoTree(const PFParticlesToHits& recoParticlesToHits,
                       const PFParticlesToTracks& recoParticlesToTracks,
-                      const TracksToCosmicTags& recoTracksToCosmicTags);
+                      const PFParticlesToCosmicScores& recoParticlesToCosmicScores);
 
     /**
      *  @brief Fill track-level variables using input maps between reconstructed objects
@@ -58,15 +66,26 @@ namespace lar_pandora {
      *  @param  trueHitsToParticles  mapping between true hits and particles
      *  @param  recoHitsToParticles  mapping between reconstructed hits and particles
      *  @param  particlesToTruth  mapping between MC particles and MC truth
-     *  @param  particlesToTracks  mapping between reconstructed particles and tracks
-     *  @param  tracksToCosmicTags  mapping between reconstructed tracks and cosmic tags
+     *  @param  particlesToCosmicScores  mapping between reconstructed particles and cosmic scores
      */
     void FillTrueTree(const HitVector& hitVector,
                       const HitsToMCParticles& trueHitsToParticles,
                       const HitsToPFParticles& recoHitsToParticles,
                       const MCParticlesToMCTruth& particlesToTruth,
-                      const PFParticlesToTracks& particlesToTracks,
-                      const TracksToCosmicTags& tracksToCosmicTags);
+                      const PFParticlesToCosmicScores& particlesToCosmicScores);
+
+    /**
+     *  @brief Get the cosmic score of each PFParticle, from either the cosmic tags or the metadata
+     *
+     *  @param  evt  the art event
+     *  @param  recoParticleVector  the input reconstructed particles
+     *  @param  recoParticlesToTracks  mapping between reconstructed particles and tracks
+     *  @param  recoParticlesToCosmicScores  to receive the mapping from particles to cosmic scores
+     */
+    void GetCosmicScores(const art::Event& evt,
+                         const PFParticleVector& recoParticleVector,
+                         const PFParticlesToTracks& recoParticlesToTracks,
+                         PFParticlesToCosmicScores& recoParticlesToCosmicScores) const;
 
     /**
      *  @brief Get cosmic score for a PFParticle using track-level information
@@ -79,9 +98,36 @@ namespace lar_pandora {
                          const PFParticlesToTracks& recoParticlesToTracks,
                          const TracksToCosmicTags& recoTracksToCosmicTags) const;
 
+    /**
+     *  @brief Get cosmic score for a PFParticle using the clear cosmic flag of its parent metadata
+     *
+     *  @param  particle  input reconstructed particle
+     *  @param  particleMap  mapping from particle IDs to particles
+     *  @param  particlesToMetadata  mapping between reconstructed particles and metadata
+     */
+    float GetMetadataCosmicScore(const art::Ptr<recob::PFParticle> particle,
+                                 const PFParticleMap& particleMap,
+                                 const PFParticlesToMetadata& particlesToMetadata) const;
+
+    /**
+     *  @brief Fill the summary histograms for the current particle
+     */
+    void FillSummaryHistograms();
+
     TTree* m_pRecoTree; ///<
     TTree* m_pTrueTree; ///<
 
+    TH1F* m_pAllVtxX;        ///< The vertex x of all particles with tracks
+    TH1F* m_pAllVtxY;        ///< The vertex y of all particles with tracks
+    TH1F* m_pAllVtxZ;        ///< The vertex z of all particles with tracks
+    TH1F* m_pTaggedVtxX;     ///< The vertex x of cosmic-tagged particles
+    TH1F* m_pTaggedVtxY;     ///< The vertex y of cosmic-tagged particles
+    TH1F* m_pTaggedVtxZ;     ///< The vertex z of cosmic-tagged particles
+    TH1F* m_pTaggedFraction; ///< The fraction of particles cosmic-tagged in each event
+
+    int m_nEventParticles;       ///< The number of particles in the current event
+    int m_nEventTaggedParticles; ///< The number of cosmic-tagged particles in the current event
+
     int m_run;   ///<
     int m_event; ///<
     int m_index; ///<
@@ -130,16 +176,21 @@ namespace lar_pandora {
     int m_nCosmicHitsNotReconstructed;
     int m_nCosmicHitsReconstructed;
 
-    std::string m_hitfinderLabel;   ///<
-    std::string m_trackfitLabel;    ///<
-    std::string m_particleLabel;    ///<
-    std::string m_cosmicLabel;      ///<
-    std::string m_geantModuleLabel; ///<
+    std::string m_hitfinderLabel;     ///<
+    std::string m_trackfitLabel;      ///<
+    std::string m_particleLabel;      ///<
+    std::string m_cosmicLabel;        ///<
+    std::string m_geantModuleLabel;   ///<
+    std::string m_truthMatchingLabel; ///<
 
     bool m_useDaughterPFParticles; ///<
     bool m_useDaughterMCParticles; ///<
+    bool m_enableTruth;            ///< Whether to read the truth and write the true tree
+    bool m_useMetadataCosmicScore; ///< Whether to take the cosmic score from the metadata
+    bool m_writeSummaryHistograms; ///< Whether to write the cosmic tagging summary histograms
 
-    double m_cosmicContainmentCut; ///<
+    double m_cosmicContainmentCut;  ///<
+    double m_summaryCosmicScoreCut; ///< The cosmic score above which a particle is tagged
   };
 
   DEFINE_ART_MODULE(PFParticleCosmicAna)
@@ -162,9 +213,13 @@ namespace lar_pandora {
 #include "larcore/Geometry/Geometry.h"
 #include "lardataobj/AnalysisBase/CosmicTag.h"
 #include "lardataobj/RecoBase/PFParticle.h"
+#include "lardataobj/RecoBase/PFParticleMetadata.h"
 #include "lardataobj/RecoBase/Track.h"
 #include "nusimdata/SimulationBase/MCTruth.h"
 
+#include "TH1F.h"
+
+#include <cmath>
 #include <iostream>
 
 namespace lar_pandora {
@@ -187,11 +242,16 @@ namespace lar_pandora {
     m_trackfitLabel = pset.get<std::string>("TrackFitModule", "trackfit");
     m_hitfinderLabel = pset.get<std::string>("HitFinderModule", "gaushit");
     m_geantModuleLabel = pset.get<std::string>("GeantModule", "largeant");
+    m_truthMatchingLabel = pset.get<std::string>("TruthMatchingModule", "");
 
     m_useDaughterPFParticles = pset.get<bool>("UseDaughterPFParticles", true);
     m_useDaughterMCParticles = pset.get<bool>("UseDaughterMCParticles", true);
+    m_enableTruth = pset.get<bool>("EnableTruth", true);
+    m_useMetadataCosmicScore = pset.get<bool>("UseMetadataCosmicScore", false);
+    m_writeSummaryHistograms = pset.get<bool>("WriteSummaryHistograms", false);
 
     m_cosmicContainmentCut = pset.get<double>("CosmicContainmentCut", 5.0);
+    m_summaryCosmicScoreCut = pset.get<double>("SummaryCosmicScoreCut", 0.51);
   }
 
   //------------------------------------------------------------------------------------------------------------------------------------------
@@ -235,6 +295,31 @@ namespace lar_pandora {
     m_pRecoTree->Branch("nTracks", &m_nTracks, "nTracks/I");
     m_pRecoTree->Branch("nHits", &m_nHits, "nHits/I");
 
+    m_pAllVtxX = m_pAllVtxY = m_pAllVtxZ = nullptr;
+    m_pTaggedVtxX = m_pTaggedVtxY = m_pTaggedVtxZ = nullptr;
+    m_pTaggedFraction = nullptr;
+
+    if (m_writeSummaryHistograms) {
+      art::ServiceHandle<geo::Geometry const> theGeometry;
+      const double xmax(2.0 * theGeometry->DetHalfWidth());
+      const double ymax(theGeometry->DetHalfHeight());
+      const double zmax(theGeometry->DetLength());
+
+      m_pAllVtxX = tfs->make<TH1F>("allVtxX", "All particles;Vertex x [cm]", 50, 0.0, xmax);
+      m_pAllVtxY = tfs->make<TH1F>("allVtxY", "All particles;Vertex y [cm]", 50, -ymax, ymax);
+      m_pAllVtxZ = tfs->make<TH1F>("allVtxZ", "All particles;Vertex z [cm]", 50, 0.0, zmax);
+      m_pTaggedVtxX =
+        tfs->make<TH1F>("taggedVtxX", "Cosmic-tagged particles;Vertex x [cm]", 50, 0.0, xmax);
+      m_pTaggedVtxY =
+        tfs->make<TH1F>("taggedVtxY", "Cosmic-tagged particles;Vertex y [cm]", 50, -ymax, ymax);
+      m_pTaggedVtxZ =
+        tfs->make<TH1F>("taggedVtxZ", "Cosmic-tagged particles;Vertex z [cm]", 50, 0.0, zmax);
+      m_pTaggedFraction = tfs->make<TH1F>(
+        "taggedFraction", "Cosmic-tagged fraction per event;Fraction;Events", 20, 0.0, 1.0 + 1e-6);
+    }
+
+    if (!m_enableTruth) return;
+
     m_pTrueTree = tfs->make<TTree>("trueTree", "LAr Cosmic True Tree");
     m_pTrueTree->Branch("run", &m_run, "run/I");
     m_pTrueTree->Branch("event", &m_event, "event/I");
@@ -284,26 +369,6 @@ namespace lar_pandora {
     std::cout << "  Run: " << m_run << std::endl;
     std::cout << "  Event: " << m_event << std::endl;
 
-    // Collect True Particles
-    // ======================
-    HitVector hitVector;
-    MCTruthToMCParticles truthToParticles;
-    MCParticlesToMCTruth particlesToTruth;
-    MCParticlesToHits trueParticlesToHits;
-    HitsToMCParticles trueHitsToParticles;
-
-    LArPandoraHelper::CollectHits(evt, m_hitfinderLabel, hitVector);
-    LArPandoraHelper::CollectMCParticles(
-      evt, m_geantModuleLabel, truthToParticles, particlesToTruth);
-    LArPandoraHelper::BuildMCParticleHitMaps(evt,
-                                             m_geantModuleLabel,
-                                             hitVector,
-                                             trueParticlesToHits,
-                                             trueHitsToParticles,
-                                             (m_useDaughterMCParticles ?
-                                                LArPandoraHelper::kAddDaughters :
-                                                LArPandoraHelper::kIgnoreDaughters));
-
     // Collect Reco Particles
     // ======================
     PFParticleVector recoParticleVector;
@@ -328,16 +393,47 @@ namespace lar_pandora {
     PFParticlesToTracks recoParticlesToTracks;
     LArPandoraHelper::CollectTracks(evt, m_trackfitLabel, recoTrackVector, recoParticlesToTracks);
 
-    // Collect Cosmic Tags
-    // =====================
-    CosmicTagVector recoCosmicTagVector;
-    TracksToCosmicTags recoTracksToCosmicTags;
-    LArPandoraHelper::CollectCosmicTags(
-      evt, m_cosmicLabel, recoCosmicTagVector, recoTracksToCosmicTags);
+    // Get Cosmic Scores
+    // =================
+    PFParticlesToCosmicScores recoParticlesToCosmicScores;
+    this->GetCosmicScores(
+      evt, recoParticleVector, recoParticlesToTracks, recoParticlesToCosmicScores);
 
     // Analyse Reconstructed Particles
     // ===============================
-    this->FillRecoTree(recoParticlesToHits, recoParticlesToTracks, recoTracksToCosmicTags);
+    this->FillRecoTree(recoParticlesToHits, recoParticlesToTracks, recoParticlesToCosmicScores);
+
+    if (!m_enableTruth) return;
+
+    // Collect True Particles
+    // ======================
+    HitVector hitVector;
+    MCTruthToMCParticles truthToParticles;
+    MCParticlesToMCTruth particlesToTruth;
+    MCParticlesToHits trueParticlesToHits;
+    HitsToMCParticles trueHitsToParticles;
+
+    LArPandoraHelper::CollectHits(evt, m_hitfinderLabel, hitVector);
+    LArPandoraHelper::CollectMCParticles(
+      evt, m_geantModuleLabel, truthToParticles, particlesToTruth);
+
+    const LArPandoraHelper::DaughterMode daughterMode(m_useDaughterMCParticles ?
+                                                        LArPandoraHelper::kAddDaughters :
+                                                        LArPandoraHelper::kIgnoreDaughters);
+
+    if (!m_truthMatchingLabel.empty()) {
+      LArPandoraHelper::BuildMCParticleHitMaps(evt,
+                                               m_geantModuleLabel,
+                                               m_hitfinderLabel,
+                                               m_truthMatchingLabel,
+                                               trueParticlesToHits,
+                                               trueHitsToParticles,
+                                               daughterMode);
+    }
+    else {
+      LArPandoraHelper::BuildMCParticleHitMaps(
+        evt, m_geantModuleLabel, hitVector, trueParticlesToHits, trueHitsToParticles, daughterMode);
+    }
 
     // Analyse True Hits
     // =================
@@ -345,15 +441,15 @@ namespace lar_pandora {
                        trueHitsToParticles,
                        recoHitsToParticles,
                        particlesToTruth,
-                       recoParticlesToTracks,
-                       recoTracksToCosmicTags);
+                       recoParticlesToCosmicScores);
   }
 
   //------------------------------------------------------------------------------------------------------------------------------------------
 
-  void PFParticleCosmicAna::FillRecoTree(const PFParticlesToHits& recoParticlesToHits,
-                                         const PFParticlesToTracks& recoParticlesToTracks,
-                                         const TracksToCosmicTags& recoTracksToCosmicTags)
+  void PFParticleCosmicAna::FillRecoTree(
+    const PFParticlesToHits& recoParticlesToHits,
+    const PFParticlesToTracks& recoParticlesToTracks,
+    const PFParticlesToCosmicScores& recoParticlesToCosmicScores)
   {
     // Set up Geometry Service
     // =======================
@@ -400,6 +496,9 @@ namespace lar_pandora {
     m_nTracks = 0;
     m_nHits = 0;
 
+    m_nEventParticles = 0;
+    m_nEventTaggedParticles = 0;
+
     // Loop over Reco Particles
     // ========================
     for (PFParticlesToHits::const_iterator iter1 = recoParticlesToHits.begin(),
@@ -424,8 +523,7 @@ namespace lar_pandora {
       m_pdgCode = recoParticle->PdgCode();
       m_isPrimary = recoParticle->IsPrimary();
       m_isTrackLike = LArPandoraHelper::IsTrack(recoParticle);
-      m_cosmicScore =
-        this->GetCosmicScore(recoParticle, recoParticlesToTracks, recoTracksToCosmicTags);
+      m_cosmicScore = recoParticlesToCosmicScores.at(recoParticle);
 
       m_trackVtxX = 0.f;
       m_trackVtxY = 0.f;
@@ -497,9 +595,15 @@ namespace lar_pandora {
       std::cout << "   PFParticle: [" << m_index << "] nHits=" << m_nHits
                 << ", nTracks=" << m_nTracks << ", cosmicScore=" << m_cosmicScore << std::endl;
 
+      if (m_writeSummaryHistograms) this->FillSummaryHistograms();
+
       m_pRecoTree->Fill();
       ++m_index;
     }
+
+    if (m_writeSummaryHistograms && (m_nEventParticles > 0))
+      m_pTaggedFraction->Fill(static_cast<float>(m_nEventTaggedParticles) /
+                              static_cast<float>(m_nEventParticles));
   }
 
   //------------------------------------------------------------------------------------------------------------------------------------------
@@ -508,8 +612,7 @@ namespace lar_pandora {
                                          const HitsToMCParticles& trueHitsToParticles,
                                          const HitsToPFParticles& recoHitsToParticles,
                                          const MCParticlesToMCTruth& particlesToTruth,
-                                         const PFParticlesToTracks& particlesToTracks,
-                                         const TracksToCosmicTags& tracksToCosmicTags)
+                                         const PFParticlesToCosmicScores& particlesToCosmicScores)
   {
     m_nHits = 0;
 
@@ -549,7 +652,9 @@ namespace lar_pandora {
       HitsToPFParticles::const_iterator iter5 = recoHitsToParticles.find(hit);
       if (recoHitsToParticles.end() != iter5) {
         const art::Ptr<recob::PFParticle> particle = iter5->second;
-        cosmicScore = this->GetCosmicScore(particle, particlesToTracks, tracksToCosmicTags);
+
+        PFParticlesToCosmicScores::const_iterator iter6 = particlesToCosmicScores.find(particle);
+        cosmicScore = (particlesToCosmicScores.end() != iter6) ? iter6->second : 0.f;
       }
 
       ++m_nHits;
@@ -591,6 +696,42 @@ namespace lar_pandora {
 
   //------------------------------------------------------------------------------------------------------------------------------------------
 
+  void PFParticleCosmicAna::GetCosmicScores(
+    const art::Event& evt,
+    const PFParticleVector& recoParticleVector,
+    const PFParticlesToTracks& recoParticlesToTracks,
+    PFParticlesToCosmicScores& recoParticlesToCosmicScores) const
+  {
+    if (m_useMetadataCosmicScore) {
+      PFParticleVector metadataParticleVector;
+      PFParticlesToMetadata particlesToMetadata;
+      LArPandoraHelper::CollectPFParticleMetadata(
+        evt, m_particleLabel, metadataParticleVector, particlesToMetadata);
+
+      PFParticleMap particleMap;
+      LArPandoraHelper::BuildPFParticleMap(recoParticleVector, particleMap);
+
+      for (const art::Ptr<recob::PFParticle>& particle : recoParticleVector)
+        recoParticlesToCosmicScores[particle] =
+          this->GetMetadataCosmicScore(particle, particleMap, particlesToMetadata);
+
+      return;
+    }
+
+    // Collect Cosmic Tags
+    // =====================
+    CosmicTagVector recoCosmicTagVector;
+    TracksToCosmicTags recoTracksToCosmicTags;
+    LArPandoraHelper::CollectCosmicTags(
+      evt, m_cosmicLabel, recoCosmicTagVector, recoTracksToCosmicTags);
+
+    for (const art::Ptr<recob::PFParticle>& particle : recoParticleVector)
+      recoParticlesToCosmicScores[particle] =
+        this->GetCosmicScore(particle, recoParticlesToTracks, recoTracksToCosmicTags);
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
   float PFParticleCosmicAna::GetCosmicScore(const art::Ptr<recob::PFParticle> particle,
                                             const PFParticlesToTracks& recoParticlesToTracks,
                                             const TracksToCosmicTags& recoTracksToCosmicTags) const
@@ -622,4 +763,48 @@ namespace lar_pandora {
     return cosmicScore;
   }
 
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  float PFParticleCosmicAna::GetMetadataCosmicScore(
+    const art::Ptr<recob::PFParticle> particle,
+    const PFParticleMap& particleMap,
+    const PFParticlesToMetadata& particlesToMetadata) const
+  {
+    // ATTN Pandora only flags the parents of clear cosmic hierarchies
+    const art::Ptr<recob::PFParticle> parent =
+      LArPandoraHelper::GetParentPFParticle(particleMap, particle);
+
+    PFParticlesToMetadata::const_iterator iter = particlesToMetadata.find(parent);
+    if (particlesToMetadata.end() == iter) return 0.f;
+
+    for (const art::Ptr<larpandoraobj::PFParticleMetadata>& metadata : iter->second) {
+      const auto& propertiesMap(metadata->GetPropertiesMap());
+      const auto propertyIter(propertiesMap.find("IsClearCosmic"));
+
+      if ((propertiesMap.end() != propertyIter) && std::round(propertyIter->second)) return 1.f;
+    }
+
+    return 0.f;
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  void PFParticleCosmicAna::FillSummaryHistograms()
+  {
+    const bool isTagged(m_cosmicScore > m_summaryCosmicScoreCut);
+
+    ++m_nEventParticles;
+    if (isTagged) ++m_nEventTaggedParticles;
+
+    m_pAllVtxX->Fill(m_trackVtxX);
+    m_pAllVtxY->Fill(m_trackVtxY);
+    m_pAllVtxZ->Fill(m_trackVtxZ);
+
+    if (!isTagged) return;
+
+    m_pTaggedVtxX->Fill(m_trackVtxX);
+    m_pTaggedVtxY->Fill(m_trackVtxY);
+    m_pTaggedVtxZ->Fill(m_trackVtxZ);
+  }
+
 } //namespace lar_pandora
@@ -10,11 +10,17 @@
 
 #include "TTree.h"
 
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h"
 #include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
 #include "lardata/DetectorInfoServices/DetectorClocksService.h"
 #include "larpandora/LArPandoraInterface/LArPandoraHelper.h"
 
+#include <deque>
+#include <memory>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -43,6 +49,67 @@ namespace lar_pandora {
     void reconfigure(fhicl::ParameterSet const& pset);
 
   private:
+    /**
+     *  @brief OutputTree class
+     *
+     *  Writes the current values of its branches either as one entry per point or, in columnar
+     *  mode, as vector branches with one entry per event
+     */
+    class OutputTree {
+    public:
+      /**
+         *  @brief  Constructor
+         *
+         *  @param  pTree the tree to write
+         *  @param  columnar whether to write one entry per event
+         */
+      OutputTree(TTree* pTree, const bool columnar);
+
+      /**
+         *  @brief  Add a branch with a single value per event
+         *
+         *  @param  name the branch name
+         *  @param  pValue address of the value
+         */
+      void AddEventBranch(const std::string& name, int* pValue);
+
+      /**
+         *  @brief  Add a branch with a value per point
+         *
+         *  @param  name the branch name
+         *  @param  pValue address of the value
+         */
+      void AddBranch(const std::string& name, int* pValue);
+      void AddBranch(const std::string& name, double* pValue);
+
+      /**
+         *  @brief  Store the current values as a point
+         */
+      void Fill();
+
+      /**
+         *  @brief  Store a placeholder entry for an event without points (not needed in columnar mode)
+         */
+      void FillDummy();
+
+      /**
+         *  @brief  Write the points stored for this event (columnar mode only)
+         */
+      void FillEvent();
+
+    private:
+      template <typename T>
+      struct Column {
+        T* m_pValue;             ///< Address of the current value
+        std::vector<T> m_values; ///< The values stored for this event
+      };
+
+      TTree* m_pTree;                             ///< The output tree
+      bool m_columnar;                            ///< Whether to write one entry per event
+      std::deque<Column<int>> m_intColumns;       ///< The integer columns (stable addresses)
+      std::deque<Column<double>> m_doubleColumns; ///< The floating point columns
+    };
+
     /**
      *  @brief Store 3D track hits
      *
@@ -93,8 +160,26 @@ namespace lar_pandora {
      *  @brief Store raw data
      *
      *  @param wireVector the input vector of reconstructed wires
+     *  @param hitVector the input vector of 2D hits
+     *  @param hitsToParticles mapping between 2D hits and PFParticles
      */
-    void FillRecoWires(const art::Event& event, const WireVector& wireVector);
+    void FillRecoWires(const art::Event& event,
+                       const WireVector& wireVector,
+                       const HitVector& hitVector,
+                       const HitsToPFParticles& hitsToParticles);
+
+    /**
+     *  @brief Collect the tick ranges of the hits selecting wire regions of interest, by channel
+     *
+     *  @param hitVector the input vector of 2D hits
+     *  @param hitsToParticles mapping between 2D hits and PFParticles
+     *  @param channelToHitRanges the output [start, end) tick ranges of the selected hits
+     */
+    void GetSelectedHitRanges(
+      const HitVector& hitVector,
+      const HitsToPFParticles& hitsToParticles,
+      std::unordered_map<raw::ChannelID_t, std::vector<std::pair<int, int>>>& channelToHitRanges)
+      const;
 
     /**
      *  @brief Conversion from wire ID to U/V/W coordinate
@@ -129,11 +214,11 @@ namespace lar_pandora {
                  const double y,
                  const double z) const;
 
-    TTree* m_pRecoTracks;     ///<
-    TTree* m_pReco3D;         ///<
-    TTree* m_pReco2D;         ///<
-    TTree* m_pRecoComparison; ///<
-    TTree* m_pRecoWire;       ///<
+    std::unique_ptr<OutputTree> m_pRecoTracks;     ///<
+    std::unique_ptr<OutputTree> m_pReco3D;         ///<
+    std::unique_ptr<OutputTree> m_pReco2D;         ///<
+    std::unique_ptr<OutputTree> m_pRecoComparison; ///<
+    std::unique_ptr<OutputTree> m_pRecoWire;       ///<
 
     int m_run;      ///<
     int m_event;    ///<
@@ -141,10 +226,12 @@ namespace lar_pandora {
     int m_primary;  ///<
     int m_pdgcode;  ///<
 
-    int m_cstat; ///<
-    int m_tpc;   ///<
-    int m_plane; ///<
-    int m_wire;  ///<
+    int m_cstat;   ///<
+    int m_tpc;     ///<
+    int m_plane;   ///<
+    int m_wire;    ///<
+    int m_channel; ///<
+    int m_tick;    ///<
 
     double m_u; ///<
     double m_v; ///<
@@ -166,8 +253,11 @@ namespace lar_pandora {
     std::string m_trackLabel;      ///<
     std::string m_showerLabel;     ///<
 
-    bool m_storeWires; ///<
-    bool m_printDebug; ///< switch for print statements (TODO: use message service!)
+    bool m_storeWires;              ///<
+    std::string m_wireROISelection; ///< which wire ROIs to store (All, Hits or PFParticles)
+    std::vector<int> m_wirePdgCodes; ///< pdg codes of PFParticles selecting ROIs (empty for all)
+    bool m_columnarOutput; ///< whether to write one entry per event, with vector branches
+    bool m_printDebug;     ///< switch for print statements (TODO: use message service!)
   };
 
   DEFINE_ART_MODULE(PFParticleHitDumper)
@@ -202,6 +292,7 @@ namespace lar_pandora {
 #include "nusimdata/SimulationBase/MCParticle.h"
 #include "nusimdata/SimulationBase/MCTruth.h"
 
+#include <algorithm>
 #include <iostream>
 
 namespace lar_pandora {
@@ -220,6 +311,16 @@ namespace lar_pandora {
   void PFParticleHitDumper::reconfigure(fhicl::ParameterSet const& pset)
   {
     m_storeWires = pset.get<bool>("StoreWires", false);
+    m_wireROISelection = pset.get<std::string>("WireROISelection", "All");
+    m_wirePdgCodes = pset.get<std::vector<int>>("WirePFParticlePdgCodes", {});
+    m_columnarOutput = pset.get<bool>("ColumnarOutput", false);
+
+    if ((m_wireROISelection != "All") && (m_wireROISelection != "Hits") &&
+        (m_wireROISelection != "PFParticles"))
+      throw cet::exception("LArPandora")
+        << " PFParticleHitDumper::reconfigure --- WireROISelection must be All, Hits or "
+           "PFParticles, not "
+        << m_wireROISelection;
     m_trackLabel = pset.get<std::string>("TrackModule", "pandoraTrack");
     m_showerLabel = pset.get<std::string>("ShowerModule", "pandoraShower");
     m_particleLabel = pset.get<std::string>("PFParticleModule", "pandora");
@@ -239,63 +340,68 @@ namespace lar_pandora {
     //
     art::ServiceHandle<art::TFileService const> tfs;
 
-    m_pRecoTracks = tfs->make<TTree>("pandoraTracks", "LAr Reco Tracks");
-    m_pRecoTracks->Branch("run", &m_run, "run/I");
-    m_pRecoTracks->Branch("event", &m_event, "event/I");
-    m_pRecoTracks->Branch("particle", &m_particle, "particle/I");
-    m_pRecoTracks->Branch("x", &m_x, "x/D");
-    m_pRecoTracks->Branch("y", &m_y, "y/D");
-    m_pRecoTracks->Branch("z", &m_z, "z/D");
-
-    m_pReco3D = tfs->make<TTree>("pandora3D", "LAr Reco 3D");
-    m_pReco3D->Branch("run", &m_run, "run/I");
-    m_pReco3D->Branch("event", &m_event, "event/I");
-    m_pReco3D->Branch("particle", &m_particle, "particle/I");
-    m_pReco3D->Branch("primary", &m_primary, "primary/I");
-    m_pReco3D->Branch("pdgcode", &m_pdgcode, "pdgcode/I");
-    m_pReco3D->Branch("cstat", &m_cstat, "cstat/I");
-    m_pReco3D->Branch("tpc", &m_tpc, "tpc/I");
-    m_pReco3D->Branch("plane", &m_plane, "plane/I");
-    m_pReco3D->Branch("x", &m_x, "x/D");
-    m_pReco3D->Branch("y", &m_y, "y/D");
-    m_pReco3D->Branch("u", &m_u, "u/D");
-    m_pReco3D->Branch("v", &m_v, "v/D");
-    m_pReco3D->Branch("z", &m_z, "z/D");
-
-    m_pReco2D = tfs->make<TTree>("pandora2D", "LAr Reco 2D");
-    m_pReco2D->Branch("run", &m_run, "run/I");
-    m_pReco2D->Branch("event", &m_event, "event/I");
-    m_pReco2D->Branch("particle", &m_particle, "particle/I");
-    m_pReco2D->Branch("pdgcode", &m_pdgcode, "pdgcode/I");
-    m_pReco2D->Branch("cstat", &m_cstat, "cstat/I");
-    m_pReco2D->Branch("tpc", &m_tpc, "tpc/I");
-    m_pReco2D->Branch("plane", &m_plane, "plane/I");
-    m_pReco2D->Branch("wire", &m_wire, "wire/I");
-    m_pReco2D->Branch("x", &m_x, "x/D");
-    m_pReco2D->Branch("w", &m_w, "w/D");
-    m_pReco2D->Branch("q", &m_q, "q/D");
-
-    m_pRecoComparison = tfs->make<TTree>("pandora2Dcomparison", "LAr Reco 2D (comparison)");
-    m_pRecoComparison->Branch("run", &m_run, "run/I");
-    m_pRecoComparison->Branch("event", &m_event, "event/I");
-    m_pRecoComparison->Branch("particle", &m_particle, "particle/I");
-    m_pRecoComparison->Branch("pdgcode", &m_pdgcode, "pdgcode/I");
-    m_pRecoComparison->Branch(
-      "hitsFromSpacePoints", &m_hitsFromSpacePoints, "hitsFromSpacePoints/I");
-    m_pRecoComparison->Branch("hitsFromClusters", &m_hitsFromClusters, "hitsFromClusters/I");
-    m_pRecoComparison->Branch(
-      "hitsFromTrackOrShower", &m_hitsFromTrackOrShower, "hitsFromTrackOrShower/I");
-
-    m_pRecoWire = tfs->make<TTree>("rawdata", "LAr Reco Wires");
-    m_pRecoWire->Branch("run", &m_run, "run/I");
-    m_pRecoWire->Branch("event", &m_event, "event/I");
-    m_pRecoWire->Branch("cstat", &m_cstat, "cstat/I");
-    m_pRecoWire->Branch("tpc", &m_tpc, "tpc/I");
-    m_pRecoWire->Branch("plane", &m_plane, "plane/I");
-    m_pRecoWire->Branch("wire", &m_wire, "wire/I");
-    m_pRecoWire->Branch("x", &m_x, "x/D");
-    m_pRecoWire->Branch("w", &m_w, "w/D");
-    m_pRecoWire->Branch("q", &m_q, "q/D");
+    m_pRecoTracks = std::make_unique<OutputTree>(
+      tfs->make<TTree>("pandoraTracks", "LAr Reco Tracks"), m_columnarOutput);
+    m_pRecoTracks->AddEventBranch("run", &m_run);
+    m_pRecoTracks->AddEventBranch("event", &m_event);
+    m_pRecoTracks->AddBranch("particle", &m_particle);
+    m_pRecoTracks->AddBranch("x", &m_x);
+    m_pRecoTracks->AddBranch("y", &m_y);
+    m_pRecoTracks->AddBranch("z", &m_z);
+
+    m_pReco3D = std::make_unique<OutputTree>(
+      tfs->make<TTree>("pandora3D", "LAr Reco 3D"), m_columnarOutput);
+    m_pReco3D->AddEventBranch("run", &m_run);
+    m_pReco3D->AddEventBranch("event", &m_event);
+    m_pReco3D->AddBranch("particle", &m_particle);
+    m_pReco3D->AddBranch("primary", &m_primary);
+    m_pReco3D->AddBranch("pdgcode", &m_pdgcode);
+    m_pReco3D->AddBranch("cstat", &m_cstat);
+    m_pReco3D->AddBranch("tpc", &m_tpc);
+    m_pReco3D->AddBranch("plane", &m_plane);
+    m_pReco3D->AddBranch("x", &m_x);
+    m_pReco3D->AddBranch("y", &m_y);
+    m_pReco3D->AddBranch("u", &m_u);
+    m_pReco3D->AddBranch("v", &m_v);
+    m_pReco3D->AddBranch("z", &m_z);
+
+    m_pReco2D = std::make_unique<OutputTree>(
+      tfs->make<TTree>("pandora2D", "LAr Reco 2D"), m_columnarOutput);
+    m_pReco2D->AddEventBranch("run", &m_run);
+    m_pReco2D->AddEventBranch("event", &m_event);
+    m_pReco2D->AddBranch("particle", &m_particle);
+    m_pReco2D->AddBranch("pdgcode", &m_pdgcode);
+    m_pReco2D->AddBranch("cstat", &m_cstat);
+    m_pReco2D->AddBranch("tpc", &m_tpc);
+    m_pReco2D->AddBranch("plane", &m_plane);
+    m_pReco2D->AddBranch("wire", &m_wire);
+    m_pReco2D->AddBranch("x", &m_x);
+    m_pReco2D->AddBranch("w", &m_w);
+    m_pReco2D->AddBranch("q", &m_q);
+
+    m_pRecoComparison = std::make_unique<OutputTree>(
+      tfs->make<TTree>("pandora2Dcomparison", "LAr Reco 2D (comparison)"), m_columnarOutput);
+    m_pRecoComparison->AddEventBranch("run", &m_run);
+    m_pRecoComparison->AddEventBranch("event", &m_event);
+    m_pRecoComparison->AddBranch("particle", &m_particle);
+    m_pRecoComparison->AddBranch("pdgcode", &m_pdgcode);
+    m_pRecoComparison->AddBranch("hitsFromSpacePoints", &m_hitsFromSpacePoints);
+    m_pRecoComparison->AddBranch("hitsFromClusters", &m_hitsFromClusters);
+    m_pRecoComparison->AddBranch("hitsFromTrackOrShower", &m_hitsFromTrackOrShower);
+
+    m_pRecoWire = std::make_unique<OutputTree>(
+      tfs->make<TTree>("rawdata", "LAr Reco Wires"), m_columnarOutput);
+    m_pRecoWire->AddEventBranch("run", &m_run);
+    m_pRecoWire->AddEventBranch("event", &m_event);
+    m_pRecoWire->AddBranch("cstat", &m_cstat);
+    m_pRecoWire->AddBranch("tpc", &m_tpc);
+    m_pRecoWire->AddBranch("plane", &m_plane);
+    m_pRecoWire->AddBranch("wire", &m_wire);
+    m_pRecoWire->AddBranch("channel", &m_channel);
+    m_pRecoWire->AddBranch("tick", &m_tick);
+    m_pRecoWire->AddBranch("x", &m_x);
+    m_pRecoWire->AddBranch("w", &m_w);
+    m_pRecoWire->AddBranch("q", &m_q);
   }
 
   //------------------------------------------------------------------------------------------------------------------------------------------
@@ -319,6 +425,8 @@ namespace lar_pandora {
     m_tpc = 0;
     m_plane = 0;
     m_wire = 0;
+    m_channel = 0;
+    m_tick = 0;
 
     m_x = 0.0;
     m_y = 0.0;
@@ -408,7 +516,15 @@ namespace lar_pandora {
     // Loop over Wires (Fill Reco Wire Tree)
     // =====================================
     if (m_printDebug) std::cout << "   PFParticleHitDumper::FillRecoWires(...) " << std::endl;
-    this->FillRecoWires(evt, wireVector);
+    this->FillRecoWires(evt, wireVector, hitVector, hitsToParticles);
+
+    // Write the event entries (columnar mode only)
+    // ============================================
+    m_pRecoTracks->FillEvent();
+    m_pReco3D->FillEvent();
+    m_pReco2D->FillEvent();
+    m_pRecoComparison->FillEvent();
+    m_pRecoWire->FillEvent();
   }
 
   //------------------------------------------------------------------------------------------------------------------------------------------
@@ -422,7 +538,7 @@ namespace lar_pandora {
     m_z = 0.0;
 
     // Create dummy entry if there are no particles
-    if (particlesToTracks.empty()) { m_pRecoTracks->Fill(); }
+    if (particlesToTracks.empty()) { m_pRecoTracks->FillDummy(); }
 
     // Loop over tracks
     for (PFParticlesToTracks::const_iterator iter = particlesToTracks.begin(),
@@ -476,7 +592,7 @@ namespace lar_pandora {
     m_z = 0.0;
 
     // Create dummy entry if there are no particles
-    if (particleVector.empty()) { m_pReco3D->Fill(); }
+    if (particleVector.empty()) { m_pReco3D->FillDummy(); }
 
     // Store associations between particle and particle ID
     PFParticleMap theParticleMap;
@@ -553,7 +669,7 @@ namespace lar_pandora {
                                                  const ShowersToHits& showersToHits)
   {
     // Create dummy entry if there are no 2D hits
-    if (particleVector.empty()) { m_pRecoComparison->Fill(); }
+    if (particleVector.empty()) { m_pRecoComparison->FillDummy(); }
 
     for (unsigned int i = 0; i < particleVector.size(); ++i) {
       //initialise variables
@@ -621,7 +737,7 @@ namespace lar_pandora {
     m_q = 0.0;
 
     // Create dummy entry if there are no 2D hits
-    if (hitVector.empty()) { m_pReco2D->Fill(); }
+    if (hitVector.empty()) { m_pReco2D->FillDummy(); }
 
     // Need DetectorProperties service to convert from ticks to X
     auto const detProp = art::ServiceHandle<detinfo::DetectorPropertiesService const>()->DataFor(e);
@@ -656,11 +772,14 @@ namespace lar_pandora {
 
   //------------------------------------------------------------------------------------------------------------------------------------------
 
-  void PFParticleHitDumper::FillRecoWires(const art::Event& e, const WireVector& wireVector)
+  void PFParticleHitDumper::FillRecoWires(const art::Event& e,
+                                          const WireVector& wireVector,
+                                          const HitVector& hitVector,
+                                          const HitsToPFParticles& hitsToParticles)
   {
 
     // Create dummy entry if there are no wires
-    if (wireVector.empty()) { m_pRecoWire->Fill(); }
+    if (wireVector.empty()) { m_pRecoWire->FillDummy(); }
 
     // Need geometry service to convert channel to wire ID
     art::ServiceHandle<geo::Geometry const> theGeometry;
@@ -668,46 +787,64 @@ namespace lar_pandora {
     // Need DetectorProperties service to convert from ticks to X
     auto const detProp = art::ServiceHandle<detinfo::DetectorPropertiesService const>()->DataFor(e);
 
+    // Find the hits whose regions of interest are stored
+    const bool selectROIs(m_wireROISelection != "All");
+    std::unordered_map<raw::ChannelID_t, std::vector<std::pair<int, int>>> channelToHitRanges;
+
+    if (selectROIs) this->GetSelectedHitRanges(hitVector, hitsToParticles, channelToHitRanges);
+
     // Loop over wires
     int signalCounter(0);
 
     for (unsigned int i = 0; i < wireVector.size(); ++i) {
       const art::Ptr<recob::Wire> wire = wireVector.at(i);
 
-      const std::vector<float>& signals(wire->Signal());
+      const auto hIter = channelToHitRanges.find(wire->Channel());
+      if (selectROIs && (channelToHitRanges.end() == hIter)) continue;
+
       const std::vector<geo::WireID> wireIds = theGeometry->ChannelToWire(wire->Channel());
 
       if ((signalCounter++) < 10 && m_printDebug)
-        std::cout << "    numWires=" << wireVector.size() << " numSignals=" << signals.size()
-                  << std::endl;
-
-      double time(0.0);
+        std::cout << "    numWires=" << wireVector.size()
+                  << " numROIs=" << wire->SignalROI().n_ranges() << std::endl;
 
+      m_channel = wire->Channel();
       m_q = 0.0;
 
-      for (std::vector<float>::const_iterator tIter = signals.begin(), tIterEnd = signals.end();
-           tIter != tIterEnd;
-           ++tIter) {
-        time += 1.0;
-        m_q = *tIter;
-
-        if (m_q < 2.0) // seems to remove most noise
+      // Only the regions of interest can hold signal, so skip the rest of the waveform
+      for (const auto& roi : wire->SignalROI().get_ranges()) {
+        const int roiStart(roi.begin_index());
+        const int roiEnd(roi.end_index());
+
+        if (selectROIs && std::none_of(hIter->second.begin(),
+                                       hIter->second.end(),
+                                       [roiStart, roiEnd](const std::pair<int, int>& hitRange) {
+                                         return (hitRange.first < roiEnd) &&
+                                                (hitRange.second > roiStart);
+                                       }))
           continue;
 
-        for (std::vector<geo::WireID>::const_iterator wIter = wireIds.begin(),
-                                                      wIterEnd = wireIds.end();
-             wIter != wIterEnd;
-             ++wIter) {
-          const geo::WireID& wireID = *wIter;
-          m_cstat = wireID.Cryostat;
-          m_tpc = wireID.TPC;
-          m_plane = wireID.Plane;
-          m_wire = wireID.Wire;
+        for (int tick = roiStart; tick < roiEnd; ++tick) {
+          m_q = roi.data()[tick - roiStart];
+
+          if (m_q < 2.0) // seems to remove most noise
+            continue;
+
+          // ATTN: The time is one tick after the index of the sample
+          const double time(tick + 1);
+          m_tick = tick;
 
-          m_x = detProp.ConvertTicksToX(time, wireID.Plane, wireID.TPC, wireID.Cryostat);
-          m_w = this->GetUVW(wireID);
+          for (const geo::WireID& wireID : wireIds) {
+            m_cstat = wireID.Cryostat;
+            m_tpc = wireID.TPC;
+            m_plane = wireID.Plane;
+            m_wire = wireID.Wire;
 
-          m_pRecoWire->Fill();
+            m_x = detProp.ConvertTicksToX(time, wireID.Plane, wireID.TPC, wireID.Cryostat);
+            m_w = this->GetUVW(wireID);
+
+            m_pRecoWire->Fill();
+          }
         }
       }
     }
@@ -715,6 +852,31 @@ namespace lar_pandora {
 
   //------------------------------------------------------------------------------------------------------------------------------------------
 
+  void PFParticleHitDumper::GetSelectedHitRanges(
+    const HitVector& hitVector,
+    const HitsToPFParticles& hitsToParticles,
+    std::unordered_map<raw::ChannelID_t, std::vector<std::pair<int, int>>>& channelToHitRanges)
+    const
+  {
+    const bool usePFParticles(m_wireROISelection == "PFParticles");
+
+    for (const art::Ptr<recob::Hit>& hit : hitVector) {
+      if (usePFParticles) {
+        HitsToPFParticles::const_iterator pIter = hitsToParticles.find(hit);
+        if (hitsToParticles.end() == pIter) continue;
+
+        if (!m_wirePdgCodes.empty() &&
+            (m_wirePdgCodes.end() ==
+             std::find(m_wirePdgCodes.begin(), m_wirePdgCodes.end(), pIter->second->PdgCode())))
+          continue;
+      }
+
+      channelToHitRanges[hit->Channel()].emplace_back(hit->StartTick(), hit->EndTick());
+    }
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
   double PFParticleHitDumper::GetUVW(const geo::WireID& wireID) const
   {
     // define UVW as closest distance from (0,0) to wire axis
@@ -766,5 +928,81 @@ namespace lar_pandora {
   }
 
   //------------------------------------------------------------------------------------------------------------------------------------------
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  PFParticleHitDumper::OutputTree::OutputTree(TTree* pTree, const bool columnar)
+    : m_pTree(pTree), m_columnar(columnar)
+  {}
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  void PFParticleHitDumper::OutputTree::AddEventBranch(const std::string& name, int* pValue)
+  {
+    m_pTree->Branch(name.c_str(), pValue, (name + "/I").c_str());
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  void PFParticleHitDumper::OutputTree::AddBranch(const std::string& name, int* pValue)
+  {
+    if (!m_columnar) {
+      m_pTree->Branch(name.c_str(), pValue, (name + "/I").c_str());
+      return;
+    }
+
+    m_intColumns.push_back({pValue, {}});
+    m_pTree->Branch(name.c_str(), &m_intColumns.back().m_values);
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  void PFParticleHitDumper::OutputTree::AddBranch(const std::string& name, double* pValue)
+  {
+    if (!m_columnar) {
+      m_pTree->Branch(name.c_str(), pValue, (name + "/D").c_str());
+      return;
+    }
+
+    m_doubleColumns.push_back({pValue, {}});
+    m_pTree->Branch(name.c_str(), &m_doubleColumns.back().m_values);
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  void PFParticleHitDumper::OutputTree::Fill()
+  {
+    if (!m_columnar) {
+      m_pTree->Fill();
+      return;
+    }
+
+    for (Column<int>& column : m_intColumns)
+      column.m_values.push_back(*column.m_pValue);
+
+    for (Column<double>& column : m_doubleColumns)
+      column.m_values.push_back(*column.m_pValue);
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  void PFParticleHitDumper::OutputTree::FillDummy()
+  {
+    if (!m_columnar) m_pTree->Fill();
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  void PFParticleHitDumper::OutputTree::FillEvent()
+  {
+    if (!m_columnar) return;
+
+    m_pTree->Fill();
+
+    for (Column<int>& column : m_intColumns)
+      column.m_values.clear();
+
+    for (Column<double>& column : m_doubleColumns)
+      column.m_values.clear();
+  }
 
 } //namespace lar_pandora
@@ -12,6 +12,7 @@
 
 #include "larpandora/LArPandoraInterface/LArPandoraHelper.h"
 
+#include <memory>
 #include <string>
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -244,11 +245,12 @@ namespace lar_pandora {
     double m_spacepointsMinX; ///<
     double m_spacepointsMaxX; ///<
 
-    std::string m_hitfinderLabel;   ///<
-    std::string m_trackLabel;       ///<
-    std::string m_particleLabel;    ///<
-    std::string m_backtrackerLabel; ///<
-    std::string m_geantModuleLabel; ///<
+    std::string m_hitfinderLabel;     ///<
+    std::string m_trackLabel;         ///<
+    std::string m_particleLabel;      ///<
+    std::string m_backtrackerLabel;   ///<
+    std::string m_truthMatchingLabel; ///<
+    std::string m_geantModuleLabel;   ///<
 
     bool m_useDaughterPFParticles; ///<
     bool m_useDaughterMCParticles; ///<
@@ -259,6 +261,9 @@ namespace lar_pandora {
     bool m_printDebug;        ///< switch for print statements (TODO: use message service!)
     bool
       m_disableRealDataCheck; ///< Whether to check if the input file contains real data before accessing MC information
+
+    std::unique_ptr<LArPandoraHelper::TPCBoundingBoxTable>
+      m_pTPCBoundingBoxTable; ///< The TPC bounds, for finding the true start and end points
   };
 
   DEFINE_ART_MODULE(PFParticleMonitoring)
@@ -315,6 +320,7 @@ namespace lar_pandora {
     m_particleLabel = pset.get<std::string>("PFParticleModule", "pandora");
     m_hitfinderLabel = pset.get<std::string>("HitFinderModule", "gaushit");
     m_backtrackerLabel = pset.get<std::string>("BackTrackerModule", "gaushitTruthMatch");
+    m_truthMatchingLabel = pset.get<std::string>("TruthMatchingModule", "");
     m_geantModuleLabel = pset.get<std::string>("GeantModule", "largeant");
 
     m_useDaughterPFParticles = pset.get<bool>("UseDaughterPFParticles", false);
@@ -331,6 +337,8 @@ namespace lar_pandora {
 
   void PFParticleMonitoring::beginJob()
   {
+    m_pTPCBoundingBoxTable = std::make_unique<LArPandoraHelper::TPCBoundingBoxTable>();
+
     mf::LogDebug("LArPandora") << " *** PFParticleMonitoring::beginJob() *** " << std::endl;
 
     //
@@ -571,32 +579,42 @@ namespace lar_pandora {
       LArPandoraHelper::CollectMCParticles(
         evt, m_geantModuleLabel, truthToParticles, particlesToTruth);
 
-      LArPandoraHelper::BuildMCParticleHitMaps(
-        evt,
-        m_geantModuleLabel,
-        hitVector,
-        trueParticlesToHits,
-        trueHitsToParticles,
-        (m_useDaughterMCParticles ? (m_addDaughterMCParticles ? LArPandoraHelper::kAddDaughters :
-                                                                LArPandoraHelper::kUseDaughters) :
-                                    LArPandoraHelper::kIgnoreDaughters));
-
-      if (trueHitsToParticles.empty()) {
+      const LArPandoraHelper::DaughterMode daughterMode(
+        m_useDaughterMCParticles ? (m_addDaughterMCParticles ? LArPandoraHelper::kAddDaughters :
+                                                               LArPandoraHelper::kUseDaughters) :
+                                   LArPandoraHelper::kIgnoreDaughters);
+
+      if (!m_truthMatchingLabel.empty()) {
+        LArPandoraHelper::BuildMCParticleHitMaps(evt,
+                                                 m_geantModuleLabel,
+                                                 m_hitfinderLabel,
+                                                 m_truthMatchingLabel,
+                                                 trueParticlesToHits,
+                                                 trueHitsToParticles,
+                                                 daughterMode);
+      }
+      else {
+        LArPandoraHelper::BuildMCParticleHitMaps(evt,
+                                                 m_geantModuleLabel,
+                                                 hitVector,
+                                                 trueParticlesToHits,
+                                                 trueHitsToParticles,
+                                                 daughterMode);
+      }
+
+      if (trueHitsToParticles.empty() && m_truthMatchingLabel.empty()) {
         if (m_backtrackerLabel.empty())
           throw cet::exception("LArPandora") << " PFParticleMonitoring::analyze - no sim channels "
                                                 "found, backtracker module must be set in FHiCL "
                                              << std::endl;
 
-        LArPandoraHelper::BuildMCParticleHitMaps(
-          evt,
-          m_geantModuleLabel,
-          m_hitfinderLabel,
-          m_backtrackerLabel,
-          trueParticlesToHits,
-          trueHitsToParticles,
-          (m_useDaughterMCParticles ? (m_addDaughterMCParticles ? LArPandoraHelper::kAddDaughters :
-                                                                  LArPandoraHelper::kUseDaughters) :
-                                      LArPandoraHelper::kIgnoreDaughters));
+        LArPandoraHelper::BuildMCParticleHitMaps(evt,
+                                                 m_geantModuleLabel,
+                                                 m_hitfinderLabel,
+                                                 m_backtrackerLabel,
+                                                 trueParticlesToHits,
+                                                 trueHitsToParticles,
+                                                 daughterMode);
       }
     }
 
@@ -1413,26 +1431,9 @@ namespace lar_pandora {
                                                   int& startT,
                                                   int& endT) const
   {
-    art::ServiceHandle<geo::Geometry const> theGeometry;
-
-    bool foundStartPosition(false);
-
-    const int numTrajectoryPoints(static_cast<int>(particle->NumberTrajectoryPoints()));
-
-    for (int nt = 0; nt < numTrajectoryPoints; ++nt) {
-      geo::Point_t const pos{particle->Vx(nt), particle->Vy(nt), particle->Vz(nt)};
-      if (theGeometry->PositionToTPCptr(pos) == nullptr) { continue; }
-
-      // TODO: Apply fiducial cut due to readout window
-
-      endT = nt;
-      if (!foundStartPosition) {
-        startT = endT;
-        foundStartPosition = true;
-      }
-    }
-
-    if (!foundStartPosition) throw cet::exception("LArPandora");
+    // TODO: Apply fiducial cut due to readout window
+    if (!m_pTPCBoundingBoxTable->GetStartAndEndPoints(*particle, startT, endT))
+      throw cet::exception("LArPandora");
   }
 
   //------------------------------------------------------------------------------------------------------------------------------------------
@@ -10,6 +10,15 @@
 #include "TTree.h"
 
 #include <string>
+#include <vector>
+
+namespace anab {
+  class Calorimetry;
+}
+
+namespace recob {
+  class Track;
+}
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -17,6 +26,10 @@ namespace lar_pandora {
 
   /**
  *  @brief  PFParticleTrackAna class
+ *
+ *  By default the calorimetry tree has one entry per trajectory point. With PerTrackOutput set,
+ *  it has one entry per track (and per plane, if calorimetry is read) with the points stored in
+ *  vector branches.
  */
   class PFParticleTrackAna : public art::EDAnalyzer {
   public:
@@ -38,6 +51,28 @@ namespace lar_pandora {
     void reconfigure(fhicl::ParameterSet const& pset);
 
   private:
+    /**
+     *  @brief  Fill the per-point vectors for a track, from its calorimetry if available
+     *
+     *  @param  track the track
+     *  @param  pCalorimetry address of the calorimetry of the track in a plane, may be nullptr
+     */
+    void FillTrackPoints(const recob::Track& track, const anab::Calorimetry* const pCalorimetry);
+
+    /**
+     *  @brief  Write the current track points, either as a single entry or as one entry per point
+     */
+    void FillCaloTree();
+
+    /**
+     *  @brief  Whether a plane passes the plane selection
+     *
+     *  @param  plane the plane
+     *
+     *  @return boolean
+     */
+    bool IsSelectedPlane(const int plane) const;
+
     TTree* m_pCaloTree; ///<
 
     int m_run;     ///<
@@ -60,10 +95,27 @@ namespace lar_pandora {
     double m_py; ///<
     double m_pz; ///<
 
+    int m_npoints; ///< The number of points of the current track (per-track output)
+
+    std::vector<double> m_dEdxVector;          ///< The dE/dx of each point of the current track
+    std::vector<double> m_dQdxVector;          ///< The dQ/dx of each point of the current track
+    std::vector<double> m_residualRangeVector; ///< The residual range of each point
+    std::vector<double> m_xVector;             ///< The x position of each point
+    std::vector<double> m_yVector;             ///< The y position of each point
+    std::vector<double> m_zVector;             ///< The z position of each point
+    std::vector<double> m_pxVector;            ///< The x direction of each point
+    std::vector<double> m_pyVector;            ///< The y direction of each point
+    std::vector<double> m_pzVector;            ///< The z direction of each point
+
     bool m_useModBox; ///<
     bool m_isCheated; ///<
 
-    std::string m_trackModuleLabel; ///<
+    bool m_perTrackOutput;         ///< Whether to write one entry per track, with vector branches
+    double m_minTrackLength;       ///< The minimum length of a track to be written
+    std::vector<int> m_caloPlanes; ///< The planes of the calorimetry to write (empty for all)
+
+    std::string m_trackModuleLabel;       ///<
+    std::string m_calorimetryModuleLabel; ///< The label of the track calorimetry (empty for none)
   };
 
   DEFINE_ART_MODULE(PFParticleTrackAna)
@@ -86,11 +138,14 @@ namespace lar_pandora {
 #include "larcore/Geometry/Geometry.h"
 #include "lardata/DetectorInfoServices/DetectorPropertiesService.h"
 #include "lardata/DetectorInfoServices/LArPropertiesService.h"
+#include "lardataobj/AnalysisBase/Calorimetry.h"
 #include "lardataobj/RecoBase/Track.h"
 
 #include "larpandora/LArPandoraInterface/LArPandoraHelper.h"
 
+#include <algorithm>
 #include <iostream>
+#include <memory>
 
 namespace lar_pandora {
 
@@ -110,6 +165,10 @@ namespace lar_pandora {
     m_useModBox = pset.get<bool>("UeModBox", true);
     m_isCheated = pset.get<bool>("IsCheated", false);
     m_trackModuleLabel = pset.get<std::string>("TrackModule", "pandora");
+    m_calorimetryModuleLabel = pset.get<std::string>("CalorimetryModule", "");
+    m_perTrackOutput = pset.get<bool>("PerTrackOutput", false);
+    m_minTrackLength = pset.get<double>("MinTrackLength", 0.0);
+    m_caloPlanes = pset.get<std::vector<int>>("CaloPlanes", {});
   }
 
   //------------------------------------------------------------------------------------------------------------------------------------------
@@ -127,6 +186,21 @@ namespace lar_pandora {
     m_pCaloTree->Branch("trkid", &m_trkid, "trkid/I");
     m_pCaloTree->Branch("plane", &m_plane, "plane/I");
     m_pCaloTree->Branch("length", &m_length, "length/D");
+
+    if (m_perTrackOutput) {
+      m_pCaloTree->Branch("npoints", &m_npoints, "npoints/I");
+      m_pCaloTree->Branch("dEdx", &m_dEdxVector);
+      m_pCaloTree->Branch("dQdx", &m_dQdxVector);
+      m_pCaloTree->Branch("residualRange", &m_residualRangeVector);
+      m_pCaloTree->Branch("x", &m_xVector);
+      m_pCaloTree->Branch("y", &m_yVector);
+      m_pCaloTree->Branch("z", &m_zVector);
+      m_pCaloTree->Branch("px", &m_pxVector);
+      m_pCaloTree->Branch("py", &m_pyVector);
+      m_pCaloTree->Branch("pz", &m_pzVector);
+      return;
+    }
+
     m_pCaloTree->Branch("dEdx", &m_dEdx, "dEdx/D");
     m_pCaloTree->Branch("dNdx", &m_dNdx, "dNdx/D");
     m_pCaloTree->Branch("dQdx", &m_dQdx, "dQdx/D");
@@ -193,73 +267,150 @@ namespace lar_pandora {
 
     m_ntracks = trackVector.size();
 
-    for (TrackVector::const_iterator iter = trackVector.begin(), iterEnd = trackVector.end();
-         iter != iterEnd;
-         ++iter) {
-      const art::Ptr<recob::Track> track = *iter;
+    std::unique_ptr<art::FindManyP<anab::Calorimetry>> pTracksToCalorimetry;
+    if (!m_calorimetryModuleLabel.empty())
+      pTracksToCalorimetry = std::make_unique<art::FindManyP<anab::Calorimetry>>(
+        trackVector, evt, m_calorimetryModuleLabel);
+
+    for (unsigned int i = 0; i < trackVector.size(); ++i) {
+      const art::Ptr<recob::Track> track = trackVector.at(i);
 
       m_trkid = track->ID();
       m_length = track->Length();
 
-      m_plane = 0;
-      m_dEdx = 0.0;
-      m_dNdx = 0.0;
-      m_dQdx = 0.0;
-      m_residualRange = 0.0;
-
-      m_x = 0.0;
-      m_y = 0.0;
-      m_z = 0.0;
-      m_px = 0.0;
-      m_py = 0.0;
-      m_pz = 0.0;
-
-      for (unsigned int p = 0; p < track->NumberTrajectoryPoints(); ++p) {
-        auto pos = track->LocationAtPoint(p);
-        auto dir = track->DirectionAtPoint(p);
-
-        m_residualRange = track->Length(p);
-
-        m_x = pos.x();
-        m_y = pos.y();
-        m_z = pos.z();
-        m_px = dir.x();
-        m_py = dir.y();
-        m_pz = dir.z();
-
-        /*************************************************************/
-        /*                          WARNING                          */
-        /*************************************************************/
-        /* The dQdx information in recob::Track has been deprecated  */
-        /* since 2016 and in 11/2018 the recob::Track interface was  */
-        /* changed and DQdxAtPoint and NumberdQdx were removed.      */
-        /* Therefore the code below is now commented out             */
-        /* (note that it was most likely not functional anyways).    */
-        /* For any issue please contact: larsoft-team@fnal.gov       */
-        /*************************************************************/
-        /*
-            const double dQdxU(track->DQdxAtPoint(p, geo::kU)); // plane 0
-            const double dQdxV(track->DQdxAtPoint(p, geo::kV)); // plane 1
-            const double dQdxW(track->DQdxAtPoint(p, geo::kW)); // plane 2
-
-            m_plane = ((dQdxU > 0.0) ? geo::kU : (dQdxV > 0.0) ? geo::kV : geo::kW);
-
-            const double adc2e(m_isCheated ? adc2eCheat : (geo::kU == m_plane) ? adc2eU : (geo::kV == m_plane) ? adc2eV : adc2eW);
-
-            m_dQdx = ((geo::kU == m_plane) ? dQdxU : (geo::kV == m_plane) ? dQdxV : dQdxW);
-
-            // TODO: Need to include T0 information (currently assume T0 = 0)
-
-            m_dNdx = ((m_dQdx / adc2e) * exp((m_x / theDetector->GetXTicksCoefficient()) * theDetector->SamplingRate() * 1.e-3 / tau));
-
-            m_dEdx = (m_useModBox ? theDetector->ModBoxCorrection(m_dNdx) : theDetector->BirksCorrection(m_dNdx));
-	    */
-        /*************************************************************/
-
-        m_pCaloTree->Fill();
-        ++m_index;
+      if (m_length < m_minTrackLength) continue;
+
+      if (!pTracksToCalorimetry) {
+        m_plane = 0;
+        this->FillTrackPoints(*track, nullptr);
+        this->FillCaloTree();
+        continue;
+      }
+
+      for (const art::Ptr<anab::Calorimetry>& calorimetry : pTracksToCalorimetry->at(i)) {
+        const geo::PlaneID& planeID(calorimetry->PlaneID());
+        m_plane = planeID.isValid ? static_cast<int>(planeID.Plane) : -1;
+
+        if (!this->IsSelectedPlane(m_plane)) continue;
+
+        this->FillTrackPoints(*track, calorimetry.get());
+        this->FillCaloTree();
+      }
+    }
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  void PFParticleTrackAna::FillTrackPoints(const recob::Track& track,
+                                           const anab::Calorimetry* const pCalorimetry)
+  {
+    m_dEdxVector.clear();
+    m_dQdxVector.clear();
+    m_residualRangeVector.clear();
+    m_xVector.clear();
+    m_yVector.clear();
+    m_zVector.clear();
+    m_pxVector.clear();
+    m_pyVector.clear();
+    m_pzVector.clear();
+
+    /*************************************************************/
+    /* The dQdx information in recob::Track has been deprecated  */
+    /* since 2016, so without a calorimetry module the points    */
+    /* are the trajectory points and dE/dx and dQ/dx are zero.   */
+    /*************************************************************/
+    if (!pCalorimetry) {
+      for (unsigned int p = 0; p < track.NumberTrajectoryPoints(); ++p) {
+        const auto pos = track.LocationAtPoint(p);
+        const auto dir = track.DirectionAtPoint(p);
+
+        m_dEdxVector.push_back(0.0);
+        m_dQdxVector.push_back(0.0);
+        m_residualRangeVector.push_back(track.Length(p));
+        m_xVector.push_back(pos.x());
+        m_yVector.push_back(pos.y());
+        m_zVector.push_back(pos.z());
+        m_pxVector.push_back(dir.x());
+        m_pyVector.push_back(dir.y());
+        m_pzVector.push_back(dir.z());
       }
+
+      return;
     }
+
+    const std::vector<float>& dEdx(pCalorimetry->dEdx());
+    const std::vector<float>& dQdx(pCalorimetry->dQdx());
+    const std::vector<float>& residualRange(pCalorimetry->ResidualRange());
+    const auto& positions(pCalorimetry->XYZ());
+    const std::vector<size_t>& tpIndices(pCalorimetry->TpIndices());
+
+    for (unsigned int p = 0; p < dEdx.size(); ++p) {
+      m_dEdxVector.push_back(dEdx.at(p));
+      m_dQdxVector.push_back((p < dQdx.size()) ? dQdx.at(p) : 0.0);
+      m_residualRangeVector.push_back((p < residualRange.size()) ? residualRange.at(p) : 0.0);
+
+      if (p < positions.size()) {
+        m_xVector.push_back(positions.at(p).X());
+        m_yVector.push_back(positions.at(p).Y());
+        m_zVector.push_back(positions.at(p).Z());
+      }
+      else {
+        m_xVector.push_back(0.0);
+        m_yVector.push_back(0.0);
+        m_zVector.push_back(0.0);
+      }
+
+      // The direction is taken from the trajectory point the calorimetry point was made from
+      if ((p < tpIndices.size()) && (tpIndices.at(p) < track.NumberTrajectoryPoints())) {
+        const auto dir = track.DirectionAtPoint(tpIndices.at(p));
+        m_pxVector.push_back(dir.x());
+        m_pyVector.push_back(dir.y());
+        m_pzVector.push_back(dir.z());
+      }
+      else {
+        m_pxVector.push_back(0.0);
+        m_pyVector.push_back(0.0);
+        m_pzVector.push_back(0.0);
+      }
+    }
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  void PFParticleTrackAna::FillCaloTree()
+  {
+    m_npoints = m_dEdxVector.size();
+
+    if (m_perTrackOutput) {
+      m_pCaloTree->Fill();
+      ++m_index;
+      return;
+    }
+
+    for (int p = 0; p < m_npoints; ++p) {
+      m_dEdx = m_dEdxVector.at(p);
+      m_dNdx = 0.0;
+      m_dQdx = m_dQdxVector.at(p);
+      m_residualRange = m_residualRangeVector.at(p);
+
+      m_x = m_xVector.at(p);
+      m_y = m_yVector.at(p);
+      m_z = m_zVector.at(p);
+      m_px = m_pxVector.at(p);
+      m_py = m_pyVector.at(p);
+      m_pz = m_pzVector.at(p);
+
+      m_pCaloTree->Fill();
+      ++m_index;
+    }
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  bool PFParticleTrackAna::IsSelectedPlane(const int plane) const
+  {
+    return (m_caloPlanes.empty() ||
+            (m_caloPlanes.end() != std::find(m_caloPlanes.begin(), m_caloPlanes.end(), plane)));
   }
 
 } //namespace lar_pandora
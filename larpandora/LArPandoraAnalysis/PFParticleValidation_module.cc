@@ -12,6 +12,7 @@
 #include "larpandora/LArPandoraInterface/LArPandoraHelper.h"
 
 #include <string>
+#include <vector>
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -67,6 +68,7 @@ namespace lar_pandora {
       int m_nMCHitsW;                     ///< The number of w mc hits
       float m_energy;                     ///< The energy
       int m_nMatchedPfos;                 ///< The number of matched pfos
+      int m_tableIndex;                   ///< The index of the mc primary in the matching table
       const simb::MCParticle* m_pAddress; ///< The address of the mc primary
     };
 
@@ -117,8 +119,111 @@ namespace lar_pandora {
     typedef std::map<SimpleMCPrimary, SimpleMatchedPfoList>
       MCPrimaryMatchingMap; // SimpleMCPrimary has a defined operator<
 
-    typedef std::map<art::Ptr<recob::PFParticle>, HitVector> PFParticleToMatchedHits;
-    typedef std::map<art::Ptr<simb::MCParticle>, PFParticleToMatchedHits> MCParticleMatchingMap;
+    /**
+     *  @brief MatchingConfig class, the thresholds used in the matching scheme
+     */
+    class MatchingConfig {
+    public:
+      /**
+         *  @brief  Constructor, with the default thresholds
+         */
+      MatchingConfig();
+
+      std::string m_name; ///< The name of the configuration, empty for the top-level thresholds
+      bool
+        m_neutrinoInducedOnly; ///< Whether to consider only mc particles that were neutrino induced
+      int
+        m_matchingMinPrimaryHits; ///< The minimum number of good mc primary hits used in matching scheme
+      int
+        m_matchingMinHitsForGoodView; ///< The minimum number of good mc primary hits in given view to declare view to be good
+      int m_matchingMinPrimaryGoodViews; ///< The minimum number of good views for a mc primary
+      bool
+        m_useSmallPrimaries; ///< Whether to consider matches to mc primaries with fewer than m_matchingMinPrimaryHits
+      int m_matchingMinSharedHits; ///< The minimum number of shared hits used in matching scheme
+      float m_matchingMinCompleteness; ///< The minimum particle completeness to declare a match
+      float m_matchingMinPurity;       ///< The minimum particle purity to declare a match
+    };
+
+    typedef std::vector<MatchingConfig> MatchingConfigList;
+
+    /**
+     *  @brief MatchingSummary class, the matching outcomes of a configuration over the job
+     */
+    class MatchingSummary {
+    public:
+      /**
+         *  @brief  Default constructor
+         */
+      MatchingSummary();
+
+      int m_nEvents;                 ///< The number of events
+      int m_nCalculableEvents;       ///< The number of events with a non-neutron target primary
+      int m_nCorrectEvents;          ///< The number of correct events
+      int m_nTargetPrimaries;        ///< The number of target primaries
+      int m_nCorrectTargetPrimaries; ///< The number of target primaries with exactly one good match
+    };
+
+    typedef std::vector<MatchingSummary> MatchingSummaryList;
+
+    /**
+     *  @brief  Read a matching configuration
+     *
+     *  @param  pset the parameter set describing the configuration
+     *  @param  defaults the configuration providing any thresholds not in the parameter set
+     *
+     *  @return the matching configuration
+     */
+    static MatchingConfig ReadMatchingConfig(const fhicl::ParameterSet& pset,
+                                             const MatchingConfig& defaults);
+
+    /**
+     *  @brief HitCounts class
+     */
+    class HitCounts {
+    public:
+      /**
+         *  @brief  Constructor
+         */
+      HitCounts();
+
+      /**
+         *  @brief  Count a hit
+         *
+         *  @param  view the view of the hit
+         */
+      void AddHit(const geo::View_t view);
+
+      int m_nHitsTotal; ///< The total number of hits
+      int m_nHitsU;     ///< The number of u hits
+      int m_nHitsV;     ///< The number of v hits
+      int m_nHitsW;     ///< The number of w hits
+    };
+
+    /**
+     *  @brief MCParticleMatchingTable class, the hits shared by each mc particle and pfo
+     *
+     *  Mc particles and pfos are given dense indices and the shared hit counts are stored in a
+     *  flat mc particle x pfo matrix, rather than collecting the shared hits themselves
+     */
+    class MCParticleMatchingTable {
+    public:
+      /**
+         *  @brief  Get the hits shared by a mc particle and a pfo
+         *
+         *  @param  mcIndex the index of the mc particle
+         *  @param  pfoIndex the index of the pfo
+         */
+      HitCounts& GetSharedHits(const unsigned int mcIndex, const unsigned int pfoIndex);
+      const HitCounts& GetSharedHits(const unsigned int mcIndex,
+                                     const unsigned int pfoIndex) const;
+
+      MCParticleVector m_mcParticles;      ///< The mc particles with hits, by index
+      PFParticleVector m_pfos;             ///< The pfos, by index
+      std::vector<HitCounts> m_pfoHits;    ///< The hits of each pfo
+      std::vector<int> m_parentIndices;    ///< The index of the parent of each pfo (-1 if none)
+      std::vector<int> m_nMatchedPfos;     ///< The number of pfos sharing hits with each mc particle
+      std::vector<HitCounts> m_sharedHits; ///< The shared hits, a row per mc particle
+    };
 
     /**
      *  @brief  Performing matching between true and reconstructed particles
@@ -126,12 +231,12 @@ namespace lar_pandora {
      *  @param  recoParticlesToHits the mapping from reconstructed particles to hits
      *  @param  trueParticlesToHits the mapping from true particles to hits
      *  @param  hitsToTrueParticles the mapping from hits to true particles
-     *  @param  mcParticleMatchingMap the output matches between all reconstructed and true particles
+     *  @param  matchingTable the output matches between all reconstructed and true particles
      */
-    void GetMCParticleMatchingMap(const PFParticlesToHits& recoParticlesToHits,
-                                  const MCParticlesToHits& trueParticlesToHits,
-                                  const HitsToMCParticles& hitsToTrueParticles,
-                                  MCParticleMatchingMap& mcParticleMatchingMap) const;
+    void GetMCParticleMatchingTable(const PFParticlesToHits& recoParticlesToHits,
+                                    const MCParticlesToHits& trueParticlesToHits,
+                                    const HitsToMCParticles& hitsToTrueParticles,
+                                    MCParticleMatchingTable& matchingTable) const;
 
     /**
      *  @brief  Extract details of each mc primary (ordered by number of true hits)
@@ -139,26 +244,26 @@ namespace lar_pandora {
      *  @param  evt the event
      *  @param  mcParticlesToHits the mc primary to hits map
      *  @param  hitsToMCParticles the hits to mc particles map
-     *  @param  mcParticleMatchingMap the mc to particle to pf particle matching map (to record number of matched pf particles)
+     *  @param  matchingTable the mc particle to pf particle matching table (to record number of matched pf particles)
+     *  @param  neutrinoInducedOnly whether to consider only mc particles that were neutrino induced
      *  @param  simpleMCPrimaryList to receive the populated simple mc primary list
      */
     void GetSimpleMCPrimaryList(const art::Event& evt,
                                 const MCParticlesToHits& mcParticlesToHits,
                                 const HitsToMCParticles& hitsToMCParticles,
-                                const MCParticleMatchingMap& mcParticleMatchingMap,
+                                const MCParticleMatchingTable& matchingTable,
+                                const bool neutrinoInducedOnly,
                                 SimpleMCPrimaryList& simpleMCPrimaryList) const;
 
     /**
      *  @brief  Obtain a sorted list of matched pfos for each mc primary
      *
      *  @param  simpleMCPrimaryList the simple mc primary list
-     *  @param  mcToFullPfoMatchingMap the mc to full pfo matching map
-     *  @param  pfoToHitListMap the pfo to hit list map
+     *  @param  matchingTable the mc particle to pfo matching table
      *  @param  mcPrimaryMatchingMap to receive the populated mc primary matching map
      */
     void GetMCPrimaryMatchingMap(const SimpleMCPrimaryList& simpleMCPrimaryList,
-                                 const MCParticleMatchingMap& mcParticleMatchingMap,
-                                 const PFParticlesToHits& pfParticlesToHits,
+                                 const MCParticleMatchingTable& matchingTable,
                                  MCPrimaryMatchingMap& mcPrimaryMatchingMap) const;
 
     /**
@@ -202,55 +307,67 @@ namespace lar_pandora {
     /**
      *  @brief  Apply a well-defined matching procedure to the comprehensive matches in the provided mc primary matching map
      *
+     *  @param  matchingConfig the matching configuration
      *  @param  mcPrimaryMatchingMap the input/raw mc primary matching map
      *  @param  matchingDetailsMap the matching details map, to be populated
      */
-    void PerformMatching(const MCPrimaryMatchingMap& mcPrimaryMatchingMap,
+    void PerformMatching(const MatchingConfig& matchingConfig,
+                         const MCPrimaryMatchingMap& mcPrimaryMatchingMap,
                          MatchingDetailsMap& matchingDetailsMap) const;
 
-    typedef std::set<int> IntSet;
+    typedef std::vector<bool> IdFlags;
 
     /**
      *  @brief  Get the strongest pfo match (most matched hits) between an available mc primary and an available pfo
      *
+     *  @param  matchingConfig the matching configuration
      *  @param  mcPrimaryMatchingMap the input/raw mc primary matching map
-     *  @param  usedMCIds the list of mc primary ids with an existing match
-     *  @param  usedPfoIds the list of pfo ids with an existing match
+     *  @param  usedMCIds flags, by id, for the mc primaries with an existing match
+     *  @param  usedPfoIds flags, by id, for the pfos with an existing match
      *  @param  matchingDetailsMap the matching details map, to be populated
      */
-    bool GetStrongestPfoMatch(const MCPrimaryMatchingMap& mcPrimaryMatchingMap,
-                              IntSet& usedMCIds,
-                              IntSet& usedPfoIds,
+    bool GetStrongestPfoMatch(const MatchingConfig& matchingConfig,
+                              const MCPrimaryMatchingMap& mcPrimaryMatchingMap,
+                              IdFlags& usedMCIds,
+                              IdFlags& usedPfoIds,
                               MatchingDetailsMap& matchingDetailsMap) const;
 
     /**
      *  @brief  Get the best matches for any pfos left-over after the strong matching procedure
      *
+     *  @param  matchingConfig the matching configuration
      *  @param  mcPrimaryMatchingMap the input/raw mc primary matching map
-     *  @param  usedPfoIds the list of pfo ids with an existing match
+     *  @param  usedPfoIds flags, by id, for the pfos with an existing match
      *  @param  matchingDetailsMap the matching details map, to be populated
      */
-    void GetRemainingPfoMatches(const MCPrimaryMatchingMap& mcPrimaryMatchingMap,
-                                const IntSet& usedPfoIds,
+    void GetRemainingPfoMatches(const MatchingConfig& matchingConfig,
+                                const MCPrimaryMatchingMap& mcPrimaryMatchingMap,
+                                const IdFlags& usedPfoIds,
                                 MatchingDetailsMap& matchingDetailsMap) const;
 
     /**
      *  @brief  Print the results of the matching procedure
      *
+     *  @param  matchingConfig the matching configuration
      *  @param  mcPrimaryMatchingMap the input/raw mc primary matching map
      *  @param  matchingDetailsMap the matching details map
+     *  @param  matchingSummary the summary of the configuration, to be updated
      */
-    void PrintMatchingOutput(const MCPrimaryMatchingMap& mcPrimaryMatchingMap,
-                             const MatchingDetailsMap& matchingDetailsMap) const;
+    void PrintMatchingOutput(const MatchingConfig& matchingConfig,
+                             const MCPrimaryMatchingMap& mcPrimaryMatchingMap,
+                             const MatchingDetailsMap& matchingDetailsMap,
+                             MatchingSummary& matchingSummary) const;
 
     /**
      *  @brief  Whether a provided mc primary passes selection, based on number of "good" hits
      *
+     *  @param  matchingConfig the matching configuration
      *  @param  simpleMCPrimary the simple mc primary
      *
      *  @return boolean
      */
-    bool IsGoodMCPrimary(const SimpleMCPrimary& simpleMCPrimary) const;
+    bool IsGoodMCPrimary(const MatchingConfig& matchingConfig,
+                         const SimpleMCPrimary& simpleMCPrimary) const;
 
     /**
      *  @brief  Whether a provided mc primary has a match, of any quality (use simple matched pfo list and information in matching details map)
@@ -268,12 +385,14 @@ namespace lar_pandora {
     /**
      *  @brief  Whether a provided mc primary and pfo are deemed to be a good match
      *
+     *  @param  matchingConfig the matching configuration
      *  @param  simpleMCPrimary the simple mc primary
      *  @param  simpleMatchedPfo the simple matched pfo
      *
      *  @return boolean
      */
-    bool IsGoodMatch(const SimpleMCPrimary& simpleMCPrimary,
+    bool IsGoodMatch(const MatchingConfig& matchingConfig,
+                     const SimpleMCPrimary& simpleMCPrimary,
                      const SimpleMatchedPfo& simpleMatchedPfo) const;
 
     /**
@@ -306,28 +425,17 @@ namespace lar_pandora {
      */
     static bool SortSimpleMatchedPfos(const SimpleMatchedPfo& lhs, const SimpleMatchedPfo& rhs);
 
-    std::string m_hitfinderLabel;   ///< The name/label of the hit producer module
-    std::string m_particleLabel;    ///< The name/label of the particle producer module
-    std::string m_geantModuleLabel; ///< The name/label of the geant module
-    std::string m_backtrackerLabel; ///< The name/label of the back-tracker module
+    std::string m_hitfinderLabel;     ///< The name/label of the hit producer module
+    std::string m_particleLabel;      ///< The name/label of the particle producer module
+    std::string m_geantModuleLabel;   ///< The name/label of the geant module
+    std::string m_backtrackerLabel;   ///< The name/label of the back-tracker module
+    std::string m_truthMatchingLabel; ///< The name/label of a shared hit truth matching module
 
     bool m_printAllToScreen;      ///< Whether to print all/raw matching details to screen
     bool m_printMatchingToScreen; ///< Whether to print matching output to screen
 
-    bool
-      m_neutrinoInducedOnly; ///< Whether to consider only mc particles that were neutrino induced
-
-    int
-      m_matchingMinPrimaryHits; ///< The minimum number of good mc primary hits used in matching scheme
-    int
-      m_matchingMinHitsForGoodView; ///< The minimum number of good mc primary hits in given view to declare view to be good
-    int m_matchingMinPrimaryGoodViews; ///< The minimum number of good views for a mc primary
-
-    bool
-      m_useSmallPrimaries; ///< Whether to consider matches to mc primaries with fewer than m_matchingMinPrimaryHits
-    int m_matchingMinSharedHits;     ///< The minimum number of shared hits used in matching scheme
-    float m_matchingMinCompleteness; ///< The minimum particle completeness to declare a match
-    float m_matchingMinPurity;       ///< The minimum particle purity to declare a match
+    MatchingConfigList m_matchingConfigs;    ///< The matching configurations to evaluate
+    MatchingSummaryList m_matchingSummaries; ///< The matching summary of each configuration
   };
 
   DEFINE_ART_MODULE(PFParticleValidation)
@@ -369,16 +477,54 @@ namespace lar_pandora {
     m_hitfinderLabel = pset.get<std::string>("HitFinderModule", "gaushit");
     m_geantModuleLabel = pset.get<std::string>("GeantModule", "largeant");
     m_backtrackerLabel = pset.get<std::string>("BackTrackerModule", "gaushitTruthMatch");
+    m_truthMatchingLabel = pset.get<std::string>("TruthMatchingModule", "");
     m_printAllToScreen = pset.get<bool>("PrintAllToScreen", true);
     m_printMatchingToScreen = pset.get<bool>("PrintMatchingToScreen", true);
-    m_neutrinoInducedOnly = pset.get<bool>("NeutrinoInducedOnly", true);
-    m_matchingMinPrimaryHits = pset.get<int>("MatchingMinPrimaryHits", 15);
-    m_matchingMinHitsForGoodView = pset.get<int>("MatchingMinHitsForGoodView", 5);
-    m_matchingMinPrimaryGoodViews = pset.get<int>("MatchingMinPrimaryGoodViews", 2);
-    m_useSmallPrimaries = pset.get<bool>("UseSmallPrimaries", true);
-    m_matchingMinSharedHits = pset.get<int>("MatchingMinSharedHits", 5);
-    m_matchingMinCompleteness = pset.get<float>("MatchingMinCompleteness", 0.1f);
-    m_matchingMinPurity = pset.get<float>("MatchingMinPurity", 0.5f);
+
+    // The top-level thresholds are used unless a list of configurations is provided, in which
+    // case they are the defaults for each configuration in the list
+    const MatchingConfig topLevelConfig(
+      PFParticleValidation::ReadMatchingConfig(pset, MatchingConfig()));
+
+    m_matchingConfigs.clear();
+
+    for (const fhicl::ParameterSet& configPset :
+         pset.get<std::vector<fhicl::ParameterSet>>("MatchingConfigurations", {})) {
+      MatchingConfig matchingConfig(
+        PFParticleValidation::ReadMatchingConfig(configPset, topLevelConfig));
+      matchingConfig.m_name = configPset.get<std::string>("Name");
+      m_matchingConfigs.push_back(matchingConfig);
+    }
+
+    if (m_matchingConfigs.empty()) m_matchingConfigs.push_back(topLevelConfig);
+
+    m_matchingSummaries.assign(m_matchingConfigs.size(), MatchingSummary());
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  PFParticleValidation::MatchingConfig PFParticleValidation::ReadMatchingConfig(
+    const fhicl::ParameterSet& pset,
+    const MatchingConfig& defaults)
+  {
+    MatchingConfig matchingConfig(defaults);
+    matchingConfig.m_neutrinoInducedOnly =
+      pset.get<bool>("NeutrinoInducedOnly", defaults.m_neutrinoInducedOnly);
+    matchingConfig.m_matchingMinPrimaryHits =
+      pset.get<int>("MatchingMinPrimaryHits", defaults.m_matchingMinPrimaryHits);
+    matchingConfig.m_matchingMinHitsForGoodView =
+      pset.get<int>("MatchingMinHitsForGoodView", defaults.m_matchingMinHitsForGoodView);
+    matchingConfig.m_matchingMinPrimaryGoodViews =
+      pset.get<int>("MatchingMinPrimaryGoodViews", defaults.m_matchingMinPrimaryGoodViews);
+    matchingConfig.m_useSmallPrimaries =
+      pset.get<bool>("UseSmallPrimaries", defaults.m_useSmallPrimaries);
+    matchingConfig.m_matchingMinSharedHits =
+      pset.get<int>("MatchingMinSharedHits", defaults.m_matchingMinSharedHits);
+    matchingConfig.m_matchingMinCompleteness =
+      pset.get<float>("MatchingMinCompleteness", defaults.m_matchingMinCompleteness);
+    matchingConfig.m_matchingMinPurity =
+      pset.get<float>("MatchingMinPurity", defaults.m_matchingMinPurity);
+    return matchingConfig;
   }
 
   //------------------------------------------------------------------------------------------------------------------------------------------
@@ -387,7 +533,30 @@ namespace lar_pandora {
 
   //------------------------------------------------------------------------------------------------------------------------------------------
 
-  void PFParticleValidation::endJob() {}
+  void PFParticleValidation::endJob()
+  {
+    if (!m_printMatchingToScreen) return;
+
+    std::cout << "---MATCHING-SUMMARY--------------------------------------------------------------"
+                 "---------------"
+              << std::endl;
+
+    for (unsigned int i = 0; i < m_matchingConfigs.size(); ++i) {
+      const MatchingConfig& matchingConfig(m_matchingConfigs.at(i));
+      const MatchingSummary& matchingSummary(m_matchingSummaries.at(i));
+
+      std::cout << "Configuration " << (matchingConfig.m_name.empty() ? "-" : matchingConfig.m_name)
+                << ", nEvents " << matchingSummary.m_nEvents << ", nCorrectEvents "
+                << matchingSummary.m_nCorrectEvents << " (of "
+                << matchingSummary.m_nCalculableEvents << " calculable), nCorrectTargetPrimaries "
+                << matchingSummary.m_nCorrectTargetPrimaries << " (of "
+                << matchingSummary.m_nTargetPrimaries << ")" << std::endl;
+    }
+
+    std::cout << "---------------------------------------------------------------------------------"
+                 "---------------"
+              << std::endl;
+  }
 
   //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -404,14 +573,25 @@ namespace lar_pandora {
     MCParticlesToHits mcParticlesToHits;
     HitsToMCParticles hitsToMCParticles;
 
-    LArPandoraHelper::BuildMCParticleHitMaps(evt,
-                                             m_geantModuleLabel,
-                                             hitVector,
-                                             mcParticlesToHits,
-                                             hitsToMCParticles,
-                                             LArPandoraHelper::kAddDaughters);
+    if (!m_truthMatchingLabel.empty()) {
+      LArPandoraHelper::BuildMCParticleHitMaps(evt,
+                                               m_geantModuleLabel,
+                                               m_hitfinderLabel,
+                                               m_truthMatchingLabel,
+                                               mcParticlesToHits,
+                                               hitsToMCParticles,
+                                               LArPandoraHelper::kAddDaughters);
+    }
+    else {
+      LArPandoraHelper::BuildMCParticleHitMaps(evt,
+                                               m_geantModuleLabel,
+                                               hitVector,
+                                               mcParticlesToHits,
+                                               hitsToMCParticles,
+                                               LArPandoraHelper::kAddDaughters);
+    }
 
-    if (hitsToMCParticles.empty()) {
+    if (hitsToMCParticles.empty() && m_truthMatchingLabel.empty()) {
       if (m_backtrackerLabel.empty())
         throw cet::exception("LArPandora") << " PFParticleValidation::analyze - no sim channels "
                                               "found, backtracker module must be set in FHiCL "
@@ -426,17 +606,29 @@ namespace lar_pandora {
                                                LArPandoraHelper::kAddDaughters);
     }
 
-    MCParticleMatchingMap mcParticleMatchingMap;
-    this->GetMCParticleMatchingMap(
-      pfParticlesToHits, mcParticlesToHits, hitsToMCParticles, mcParticleMatchingMap);
+    MCParticleMatchingTable matchingTable;
+    this->GetMCParticleMatchingTable(
+      pfParticlesToHits, mcParticlesToHits, hitsToMCParticles, matchingTable);
+
+    // The mc primary matching map depends only on which mc primaries are considered
+    std::map<bool, MCPrimaryMatchingMap> mcPrimaryMatchingMaps;
+
+    for (const MatchingConfig& matchingConfig : m_matchingConfigs) {
+      const bool neutrinoInducedOnly(matchingConfig.m_neutrinoInducedOnly);
+
+      if (mcPrimaryMatchingMaps.count(neutrinoInducedOnly)) continue;
 
-    SimpleMCPrimaryList simpleMCPrimaryList;
-    this->GetSimpleMCPrimaryList(
-      evt, mcParticlesToHits, hitsToMCParticles, mcParticleMatchingMap, simpleMCPrimaryList);
+      SimpleMCPrimaryList simpleMCPrimaryList;
+      this->GetSimpleMCPrimaryList(evt,
+                                   mcParticlesToHits,
+                                   hitsToMCParticles,
+                                   matchingTable,
+                                   neutrinoInducedOnly,
+                                   simpleMCPrimaryList);
 
-    MCPrimaryMatchingMap mcPrimaryMatchingMap;
-    this->GetMCPrimaryMatchingMap(
-      simpleMCPrimaryList, mcParticleMatchingMap, pfParticlesToHits, mcPrimaryMatchingMap);
+      this->GetMCPrimaryMatchingMap(
+        simpleMCPrimaryList, matchingTable, mcPrimaryMatchingMaps[neutrinoInducedOnly]);
+    }
 
     MCTruthVector mcTruthVector;
     this->GetMCTruth(evt, mcTruthVector);
@@ -445,43 +637,90 @@ namespace lar_pandora {
     this->GetRecoNeutrinos(evt, recoNeutrinoVector);
 
     if (m_printAllToScreen)
-      this->PrintAllOutput(mcTruthVector, recoNeutrinoVector, mcPrimaryMatchingMap);
+      this->PrintAllOutput(
+        mcTruthVector,
+        recoNeutrinoVector,
+        mcPrimaryMatchingMaps.at(m_matchingConfigs.front().m_neutrinoInducedOnly));
 
     if (m_printMatchingToScreen) {
-      MatchingDetailsMap matchingDetailsMap;
-      this->PerformMatching(mcPrimaryMatchingMap, matchingDetailsMap);
-      this->PrintMatchingOutput(mcPrimaryMatchingMap, matchingDetailsMap);
+      for (unsigned int i = 0; i < m_matchingConfigs.size(); ++i) {
+        const MatchingConfig& matchingConfig(m_matchingConfigs.at(i));
+        const MCPrimaryMatchingMap& mcPrimaryMatchingMap(
+          mcPrimaryMatchingMaps.at(matchingConfig.m_neutrinoInducedOnly));
+
+        MatchingDetailsMap matchingDetailsMap;
+        this->PerformMatching(matchingConfig, mcPrimaryMatchingMap, matchingDetailsMap);
+        this->PrintMatchingOutput(
+          matchingConfig, mcPrimaryMatchingMap, matchingDetailsMap, m_matchingSummaries.at(i));
+      }
     }
   }
 
   //------------------------------------------------------------------------------------------------------------------------------------------
 
-  void PFParticleValidation::GetMCParticleMatchingMap(
+  void PFParticleValidation::GetMCParticleMatchingTable(
     const PFParticlesToHits& pfParticlesToHits,
     const MCParticlesToHits& mcParticlesToHits,
     const HitsToMCParticles& hitsToMCParticles,
-    MCParticleMatchingMap& mcParticleMatchingMap) const
+    MCParticleMatchingTable& matchingTable) const
   {
-    // Create a placeholder entry for all mc particles with >0 hits
+    // Index all mc particles with >0 hits
+    std::map<art::Ptr<simb::MCParticle>, unsigned int> mcParticleIndices;
+
     for (const MCParticlesToHits::value_type& mcParticleToHitsEntry : mcParticlesToHits) {
-      if (!mcParticleToHitsEntry.second.empty())
-        (void)mcParticleMatchingMap.insert(MCParticleMatchingMap::value_type(
-          mcParticleToHitsEntry.first, PFParticleToMatchedHits()));
+      if (mcParticleToHitsEntry.second.empty()) continue;
+
+      mcParticleIndices.emplace(mcParticleToHitsEntry.first, matchingTable.m_mcParticles.size());
+      matchingTable.m_mcParticles.push_back(mcParticleToHitsEntry.first);
+    }
+
+    // Index all pfos, and find their parents
+    std::map<size_t, unsigned int> pfoIndices;
+
+    for (const PFParticlesToHits::value_type& recoParticleToHits : pfParticlesToHits) {
+      pfoIndices.emplace(recoParticleToHits.first->Self(), matchingTable.m_pfos.size());
+      matchingTable.m_pfos.push_back(recoParticleToHits.first);
+    }
+
+    const unsigned int nMCParticles(matchingTable.m_mcParticles.size());
+    const unsigned int nPfos(matchingTable.m_pfos.size());
+
+    matchingTable.m_parentIndices.assign(nPfos, -1);
+
+    for (unsigned int pfoIndex = 0; pfoIndex < nPfos; ++pfoIndex) {
+      const auto parentIter = pfoIndices.find(matchingTable.m_pfos[pfoIndex]->Parent());
+
+      if (pfoIndices.end() != parentIter)
+        matchingTable.m_parentIndices[pfoIndex] = parentIter->second;
     }
 
     // Store true to reco matching details
+    matchingTable.m_pfoHits.assign(nPfos, HitCounts());
+    matchingTable.m_nMatchedPfos.assign(nMCParticles, 0);
+    matchingTable.m_sharedHits.assign(static_cast<size_t>(nMCParticles) * nPfos, HitCounts());
+
+    unsigned int pfoIndex(0);
+
     for (const PFParticlesToHits::value_type& recoParticleToHits : pfParticlesToHits) {
-      const art::Ptr<recob::PFParticle> pRecoParticle(recoParticleToHits.first);
       const HitVector& hitVector(recoParticleToHits.second);
 
       for (const art::Ptr<recob::Hit> pHit : hitVector) {
+        const geo::View_t view(pHit->View());
+        matchingTable.m_pfoHits[pfoIndex].AddHit(view);
+
         HitsToMCParticles::const_iterator mcParticleIter = hitsToMCParticles.find(pHit);
 
         if (hitsToMCParticles.end() == mcParticleIter) continue;
 
-        const art::Ptr<simb::MCParticle> pTrueParticle = mcParticleIter->second;
-        mcParticleMatchingMap[pTrueParticle][pRecoParticle].push_back(pHit);
+        const unsigned int mcIndex(mcParticleIndices.at(mcParticleIter->second));
+        HitCounts& sharedHits(matchingTable.GetSharedHits(mcIndex, pfoIndex));
+
+        if (0 == sharedHits.m_nHitsTotal) ++matchingTable.m_nMatchedPfos[mcIndex];
+
+        sharedHits.AddHit(view);
       }
+
+      ++pfoIndex;
     }
   }
 
@@ -491,7 +730,8 @@ namespace lar_pandora {
     const art::Event& evt,
     const MCParticlesToHits& mcParticlesToHits,
     const HitsToMCParticles& hitsToMCParticles,
-    const MCParticleMatchingMap& mcParticleMatchingMap,
+    const MCParticleMatchingTable& matchingTable,
+    const bool neutrinoInducedOnly,
     SimpleMCPrimaryList& simpleMCPrimaryList) const
   {
     MCTruthToMCParticles artMCTruthToMCParticles;
@@ -499,10 +739,14 @@ namespace lar_pandora {
     LArPandoraHelper::CollectMCParticles(
       evt, m_geantModuleLabel, artMCTruthToMCParticles, artMCParticlesToMCTruth);
 
+    // ATTN The matching table indexes the mc particles with >0 hits in the order of this map
+    int tableIndex(0);
+
     for (const MCParticlesToHits::value_type& mapEntry : mcParticlesToHits) {
       const art::Ptr<simb::MCParticle> pMCPrimary(mapEntry.first);
+      const int thisTableIndex(mapEntry.second.empty() ? -1 : tableIndex++);
 
-      if (m_neutrinoInducedOnly && !this->IsNeutrinoInduced(pMCPrimary, artMCParticlesToMCTruth))
+      if (neutrinoInducedOnly && !this->IsNeutrinoInduced(pMCPrimary, artMCParticlesToMCTruth))
         continue;
 
       SimpleMCPrimary simpleMCPrimary;
@@ -521,10 +765,10 @@ namespace lar_pandora {
         simpleMCPrimary.m_nMCHitsW = this->CountHitsByType(geo::kW, hitVector);
       }
 
-      MCParticleMatchingMap::const_iterator matchedPfoIter = mcParticleMatchingMap.find(pMCPrimary);
+      simpleMCPrimary.m_tableIndex = thisTableIndex;
 
-      if (mcParticleMatchingMap.end() != matchedPfoIter)
-        simpleMCPrimary.m_nMatchedPfos = matchedPfoIter->second.size();
+      if (thisTableIndex >= 0)
+        simpleMCPrimary.m_nMatchedPfos = matchingTable.m_nMatchedPfos[thisTableIndex];
 
       simpleMCPrimaryList.push_back(simpleMCPrimary);
     }
@@ -556,73 +800,47 @@ namespace lar_pandora {
 
   void PFParticleValidation::GetMCPrimaryMatchingMap(
     const SimpleMCPrimaryList& simpleMCPrimaryList,
-    const MCParticleMatchingMap& mcParticleMatchingMap,
-    const PFParticlesToHits& pfParticlesToHits,
+    const MCParticleMatchingTable& matchingTable,
     MCPrimaryMatchingMap& mcPrimaryMatchingMap) const
   {
+    const unsigned int nPfos(matchingTable.m_pfos.size());
+
     for (const SimpleMCPrimary& simpleMCPrimary : simpleMCPrimaryList) {
       SimpleMatchedPfoList simpleMatchedPfoList;
-      MCParticleMatchingMap::const_iterator matchedPfoIter = mcParticleMatchingMap.end();
-
-      // ATTN Nasty workaround I
-      for (MCParticleMatchingMap::const_iterator iter = mcParticleMatchingMap.begin(),
-                                                 iterEnd = mcParticleMatchingMap.end();
-           iter != iterEnd;
-           ++iter) {
-        if (simpleMCPrimary.m_pAddress == iter->first.get()) {
-          matchedPfoIter = iter;
-          break;
-        };
-      }
 
-      if (mcParticleMatchingMap.end() != matchedPfoIter) {
-        for (const PFParticleToMatchedHits::value_type& contribution : matchedPfoIter->second) {
-          const art::Ptr<recob::PFParticle> pMatchedPfo(contribution.first);
-          const HitVector& matchedHitVector(contribution.second);
-
-          SimpleMatchedPfo simpleMatchedPfo;
-          simpleMatchedPfo.m_pAddress = pMatchedPfo.get();
-          simpleMatchedPfo.m_id = pMatchedPfo->Self();
-
-          // ATTN Assume pfos have either zero or one parents. Ignore parent neutrino.
-          PFParticlesToHits::const_iterator parentPfoIter = pfParticlesToHits.end();
-
-          // ATTN Nasty workaround II, bad place for another loop.
-          for (PFParticlesToHits::const_iterator iter = pfParticlesToHits.begin(),
-                                                 iterEnd = pfParticlesToHits.end();
-               iter != iterEnd;
-               ++iter) {
-            if (pMatchedPfo->Parent() == iter->first->Self()) {
-              parentPfoIter = iter;
-              break;
-            };
-          }
-
-          if ((pfParticlesToHits.end() != parentPfoIter) &&
-              !LArPandoraHelper::IsNeutrino(parentPfoIter->first))
-            simpleMatchedPfo.m_parentId = parentPfoIter->first->Self();
-
-          simpleMatchedPfo.m_pdgCode = pMatchedPfo->PdgCode();
-          simpleMatchedPfo.m_nMatchedHitsTotal = matchedHitVector.size();
-          simpleMatchedPfo.m_nMatchedHitsU = this->CountHitsByType(geo::kU, matchedHitVector);
-          simpleMatchedPfo.m_nMatchedHitsV = this->CountHitsByType(geo::kV, matchedHitVector);
-          simpleMatchedPfo.m_nMatchedHitsW = this->CountHitsByType(geo::kW, matchedHitVector);
-
-          PFParticlesToHits::const_iterator pfoHitsIter = pfParticlesToHits.find(pMatchedPfo);
-
-          if (pfParticlesToHits.end() == pfoHitsIter)
-            throw cet::exception("LArPandora")
-              << " PFParticleValidation::analyze --- Presence of PFParticle in map mandatory.";
-
-          const HitVector& pfoHitVector(pfoHitsIter->second);
-
-          simpleMatchedPfo.m_nPfoHitsTotal = pfoHitVector.size();
-          simpleMatchedPfo.m_nPfoHitsU = this->CountHitsByType(geo::kU, pfoHitVector);
-          simpleMatchedPfo.m_nPfoHitsV = this->CountHitsByType(geo::kV, pfoHitVector);
-          simpleMatchedPfo.m_nPfoHitsW = this->CountHitsByType(geo::kW, pfoHitVector);
-
-          simpleMatchedPfoList.push_back(simpleMatchedPfo);
-        }
+      for (unsigned int pfoIndex = 0;
+           (simpleMCPrimary.m_tableIndex >= 0) && (pfoIndex < nPfos);
+           ++pfoIndex) {
+        const HitCounts& matchedHits(
+          matchingTable.GetSharedHits(simpleMCPrimary.m_tableIndex, pfoIndex));
+
+        if (0 == matchedHits.m_nHitsTotal) continue;
+
+        const art::Ptr<recob::PFParticle> pMatchedPfo(matchingTable.m_pfos[pfoIndex]);
+
+        SimpleMatchedPfo simpleMatchedPfo;
+        simpleMatchedPfo.m_pAddress = pMatchedPfo.get();
+        simpleMatchedPfo.m_id = pMatchedPfo->Self();
+
+        // ATTN Assume pfos have either zero or one parents. Ignore parent neutrino.
+        const int parentIndex(matchingTable.m_parentIndices[pfoIndex]);
+
+        if ((parentIndex >= 0) && !LArPandoraHelper::IsNeutrino(matchingTable.m_pfos[parentIndex]))
+          simpleMatchedPfo.m_parentId = matchingTable.m_pfos[parentIndex]->Self();
+
+        simpleMatchedPfo.m_pdgCode = pMatchedPfo->PdgCode();
+        simpleMatchedPfo.m_nMatchedHitsTotal = matchedHits.m_nHitsTotal;
+        simpleMatchedPfo.m_nMatchedHitsU = matchedHits.m_nHitsU;
+        simpleMatchedPfo.m_nMatchedHitsV = matchedHits.m_nHitsV;
+        simpleMatchedPfo.m_nMatchedHitsW = matchedHits.m_nHitsW;
+
+        const HitCounts& pfoHits(matchingTable.m_pfoHits[pfoIndex]);
+        simpleMatchedPfo.m_nPfoHitsTotal = pfoHits.m_nHitsTotal;
+        simpleMatchedPfo.m_nPfoHitsU = pfoHits.m_nHitsU;
+        simpleMatchedPfo.m_nPfoHitsV = pfoHits.m_nHitsV;
+        simpleMatchedPfo.m_nPfoHitsW = pfoHits.m_nHitsW;
+
+        simpleMatchedPfoList.push_back(simpleMatchedPfo);
       }
 
       // Store the ordered vectors of matched pfo details
@@ -719,22 +937,32 @@ namespace lar_pandora {
 
   //------------------------------------------------------------------------------------------------------------------------------------------
 
-  void PFParticleValidation::PerformMatching(const MCPrimaryMatchingMap& mcPrimaryMatchingMap,
+  void PFParticleValidation::PerformMatching(const MatchingConfig& matchingConfig,
+                                             const MCPrimaryMatchingMap& mcPrimaryMatchingMap,
                                              MatchingDetailsMap& matchingDetailsMap) const
   {
+    // Mc primary ids run from zero; pfo ids are the pfo Self() values
+    int maxPfoId(-1);
+    for (const MCPrimaryMatchingMap::value_type& mapValue : mcPrimaryMatchingMap) {
+      for (const SimpleMatchedPfo& simpleMatchedPfo : mapValue.second)
+        maxPfoId = std::max(maxPfoId, simpleMatchedPfo.m_id);
+    }
+
     // Get best matches, one-by-one, until no more strong matches possible
-    IntSet usedMCIds, usedPfoIds;
-    while (GetStrongestPfoMatch(mcPrimaryMatchingMap, usedMCIds, usedPfoIds, matchingDetailsMap)) {}
+    IdFlags usedMCIds(mcPrimaryMatchingMap.size(), false), usedPfoIds(maxPfoId + 1, false);
+    while (GetStrongestPfoMatch(
+      matchingConfig, mcPrimaryMatchingMap, usedMCIds, usedPfoIds, matchingDetailsMap)) {}
 
     // Assign any remaining pfos to primaries, based on number of matched hits
-    GetRemainingPfoMatches(mcPrimaryMatchingMap, usedPfoIds, matchingDetailsMap);
+    GetRemainingPfoMatches(matchingConfig, mcPrimaryMatchingMap, usedPfoIds, matchingDetailsMap);
   }
 
   //------------------------------------------------------------------------------------------------------------------------------------------
 
-  bool PFParticleValidation::GetStrongestPfoMatch(const MCPrimaryMatchingMap& mcPrimaryMatchingMap,
-                                                  IntSet& usedMCIds,
-                                                  IntSet& usedPfoIds,
+  bool PFParticleValidation::GetStrongestPfoMatch(const MatchingConfig& matchingConfig,
+                                                  const MCPrimaryMatchingMap& mcPrimaryMatchingMap,
+                                                  IdFlags& usedMCIds,
+                                                  IdFlags& usedPfoIds,
                                                   MatchingDetailsMap& matchingDetailsMap) const
   {
     int bestPfoMatchId(-1);
@@ -743,14 +971,16 @@ namespace lar_pandora {
     for (const MCPrimaryMatchingMap::value_type& mapValue : mcPrimaryMatchingMap) {
       const SimpleMCPrimary& simpleMCPrimary(mapValue.first);
 
-      if (!m_useSmallPrimaries && !this->IsGoodMCPrimary(simpleMCPrimary)) continue;
+      if (!matchingConfig.m_useSmallPrimaries &&
+          !this->IsGoodMCPrimary(matchingConfig, simpleMCPrimary))
+        continue;
 
-      if (usedMCIds.count(simpleMCPrimary.m_id)) continue;
+      if (usedMCIds[simpleMCPrimary.m_id]) continue;
 
       for (const SimpleMatchedPfo& simpleMatchedPfo : mapValue.second) {
-        if (usedPfoIds.count(simpleMatchedPfo.m_id)) continue;
+        if (usedPfoIds[simpleMatchedPfo.m_id]) continue;
 
-        if (!this->IsGoodMatch(simpleMCPrimary, simpleMatchedPfo)) continue;
+        if (!this->IsGoodMatch(matchingConfig, simpleMCPrimary, simpleMatchedPfo)) continue;
 
         if (simpleMatchedPfo.m_nMatchedHitsTotal > bestMatchingDetails.m_nMatchedHits) {
           bestPfoMatchId = simpleMatchedPfo.m_id;
@@ -765,8 +995,8 @@ namespace lar_pandora {
 
     if (bestPfoMatchId > -1) {
       matchingDetailsMap[bestPfoMatchId] = bestMatchingDetails;
-      usedMCIds.insert(bestMatchingDetails.m_matchedPrimaryId);
-      usedPfoIds.insert(bestPfoMatchId);
+      usedMCIds[bestMatchingDetails.m_matchedPrimaryId] = true;
+      usedPfoIds[bestPfoMatchId] = true;
       return true;
     }
 
@@ -776,17 +1006,20 @@ namespace lar_pandora {
   //------------------------------------------------------------------------------------------------------------------------------------------
 
   void PFParticleValidation::GetRemainingPfoMatches(
+    const MatchingConfig& matchingConfig,
     const MCPrimaryMatchingMap& mcPrimaryMatchingMap,
-    const IntSet& usedPfoIds,
+    const IdFlags& usedPfoIds,
     MatchingDetailsMap& matchingDetailsMap) const
   {
     for (const MCPrimaryMatchingMap::value_type& mapValue : mcPrimaryMatchingMap) {
       const SimpleMCPrimary& simpleMCPrimary(mapValue.first);
 
-      if (!m_useSmallPrimaries && !this->IsGoodMCPrimary(simpleMCPrimary)) continue;
+      if (!matchingConfig.m_useSmallPrimaries &&
+          !this->IsGoodMCPrimary(matchingConfig, simpleMCPrimary))
+        continue;
 
       for (const SimpleMatchedPfo& simpleMatchedPfo : mapValue.second) {
-        if (usedPfoIds.count(simpleMatchedPfo.m_id)) continue;
+        if (usedPfoIds[simpleMatchedPfo.m_id]) continue;
 
         MatchingDetails& matchingDetails(matchingDetailsMap[simpleMatchedPfo.m_id]);
 
@@ -803,25 +1036,34 @@ namespace lar_pandora {
 
   //------------------------------------------------------------------------------------------------------------------------------------------
 
-  void PFParticleValidation::PrintMatchingOutput(const MCPrimaryMatchingMap& mcPrimaryMatchingMap,
-                                                 const MatchingDetailsMap& matchingDetailsMap) const
+  void PFParticleValidation::PrintMatchingOutput(const MatchingConfig& matchingConfig,
+                                                 const MCPrimaryMatchingMap& mcPrimaryMatchingMap,
+                                                 const MatchingDetailsMap& matchingDetailsMap,
+                                                 MatchingSummary& matchingSummary) const
   {
     std::cout << "---PROCESSED-MATCHING-OUTPUT-----------------------------------------------------"
                  "---------------"
               << std::endl;
-    std::cout << "MinPrimaryGoodHits " << m_matchingMinPrimaryHits << ", MinHitsForGoodView "
-              << m_matchingMinHitsForGoodView << ", MinPrimaryGoodViews "
-              << m_matchingMinPrimaryGoodViews << std::endl;
-    std::cout << "UseSmallPrimaries " << m_useSmallPrimaries << ", MinSharedHits "
-              << m_matchingMinSharedHits << ", MinCompleteness " << m_matchingMinCompleteness
-              << ", MinPurity " << m_matchingMinPurity << std::endl;
+
+    if (!matchingConfig.m_name.empty())
+      std::cout << "Configuration " << matchingConfig.m_name << ", NeutrinoInducedOnly "
+                << matchingConfig.m_neutrinoInducedOnly << std::endl;
+
+    std::cout << "MinPrimaryGoodHits " << matchingConfig.m_matchingMinPrimaryHits
+              << ", MinHitsForGoodView " << matchingConfig.m_matchingMinHitsForGoodView
+              << ", MinPrimaryGoodViews " << matchingConfig.m_matchingMinPrimaryGoodViews
+              << std::endl;
+    std::cout << "UseSmallPrimaries " << matchingConfig.m_useSmallPrimaries << ", MinSharedHits "
+              << matchingConfig.m_matchingMinSharedHits << ", MinCompleteness "
+              << matchingConfig.m_matchingMinCompleteness << ", MinPurity "
+              << matchingConfig.m_matchingMinPurity << std::endl;
 
     bool isCorrect(true), isCalculable(false);
 
     for (const MCPrimaryMatchingMap::value_type& mapValue : mcPrimaryMatchingMap) {
       const SimpleMCPrimary& simpleMCPrimary(mapValue.first);
       const bool hasMatch(this->HasMatch(simpleMCPrimary, mapValue.second, matchingDetailsMap));
-      const bool isTargetPrimary(this->IsGoodMCPrimary(simpleMCPrimary) &&
+      const bool isTargetPrimary(this->IsGoodMCPrimary(matchingConfig, simpleMCPrimary) &&
                                  (2112 != simpleMCPrimary.m_pdgCode));
 
       if (!hasMatch && !isTargetPrimary) continue;
@@ -841,7 +1083,8 @@ namespace lar_pandora {
         if (matchingDetailsMap.count(simpleMatchedPfo.m_id) &&
             (simpleMCPrimary.m_id ==
              matchingDetailsMap.at(simpleMatchedPfo.m_id).m_matchedPrimaryId)) {
-          const bool isGoodMatch(this->IsGoodMatch(simpleMCPrimary, simpleMatchedPfo));
+          const bool isGoodMatch(
+            this->IsGoodMatch(matchingConfig, simpleMCPrimary, simpleMatchedPfo));
 
           if (isGoodMatch) ++nMatches;
           std::cout << "-" << (!isGoodMatch ? "(Below threshold) " : "") << "MatchedPfo "
@@ -860,9 +1103,20 @@ namespace lar_pandora {
         }
       }
 
-      if (isTargetPrimary && (1 != nMatches)) isCorrect = false;
+      if (isTargetPrimary) {
+        ++matchingSummary.m_nTargetPrimaries;
+
+        if (1 == nMatches)
+          ++matchingSummary.m_nCorrectTargetPrimaries;
+        else
+          isCorrect = false;
+      }
     }
 
+    ++matchingSummary.m_nEvents;
+    if (isCalculable) ++matchingSummary.m_nCalculableEvents;
+    if (isCorrect && isCalculable) ++matchingSummary.m_nCorrectEvents;
+
     std::cout << std::endl << "Is correct? " << (isCorrect && isCalculable) << std::endl;
     std::cout << "---------------------------------------------------------------------------------"
                  "---------------"
@@ -871,16 +1125,17 @@ namespace lar_pandora {
 
   //------------------------------------------------------------------------------------------------------------------------------------------
 
-  bool PFParticleValidation::IsGoodMCPrimary(const SimpleMCPrimary& simpleMCPrimary) const
+  bool PFParticleValidation::IsGoodMCPrimary(const MatchingConfig& matchingConfig,
+                                             const SimpleMCPrimary& simpleMCPrimary) const
   {
-    if (simpleMCPrimary.m_nMCHitsTotal < m_matchingMinPrimaryHits) return false;
+    if (simpleMCPrimary.m_nMCHitsTotal < matchingConfig.m_matchingMinPrimaryHits) return false;
 
     int nGoodViews(0);
-    if (simpleMCPrimary.m_nMCHitsU >= m_matchingMinHitsForGoodView) ++nGoodViews;
-    if (simpleMCPrimary.m_nMCHitsV >= m_matchingMinHitsForGoodView) ++nGoodViews;
-    if (simpleMCPrimary.m_nMCHitsW >= m_matchingMinHitsForGoodView) ++nGoodViews;
+    if (simpleMCPrimary.m_nMCHitsU >= matchingConfig.m_matchingMinHitsForGoodView) ++nGoodViews;
+    if (simpleMCPrimary.m_nMCHitsV >= matchingConfig.m_matchingMinHitsForGoodView) ++nGoodViews;
+    if (simpleMCPrimary.m_nMCHitsW >= matchingConfig.m_matchingMinHitsForGoodView) ++nGoodViews;
 
-    if (nGoodViews < m_matchingMinPrimaryGoodViews) return false;
+    if (nGoodViews < matchingConfig.m_matchingMinPrimaryGoodViews) return false;
 
     return true;
   }
@@ -902,7 +1157,8 @@ namespace lar_pandora {
 
   //------------------------------------------------------------------------------------------------------------------------------------------
 
-  bool PFParticleValidation::IsGoodMatch(const SimpleMCPrimary& simpleMCPrimary,
+  bool PFParticleValidation::IsGoodMatch(const MatchingConfig& matchingConfig,
+                                         const SimpleMCPrimary& simpleMCPrimary,
                                          const SimpleMatchedPfo& simpleMatchedPfo) const
   {
     const float purity((simpleMatchedPfo.m_nPfoHitsTotal > 0) ?
@@ -914,8 +1170,9 @@ namespace lar_pandora {
                                  static_cast<float>(simpleMCPrimary.m_nMCHitsTotal) :
                                0.f);
 
-    return ((simpleMatchedPfo.m_nMatchedHitsTotal >= m_matchingMinSharedHits) &&
-            (purity >= m_matchingMinPurity) && (completeness >= m_matchingMinCompleteness));
+    return ((simpleMatchedPfo.m_nMatchedHitsTotal >= matchingConfig.m_matchingMinSharedHits) &&
+            (purity >= matchingConfig.m_matchingMinPurity) &&
+            (completeness >= matchingConfig.m_matchingMinCompleteness));
   }
 
   //------------------------------------------------------------------------------------------------------------------------------------------
@@ -968,6 +1225,7 @@ namespace lar_pandora {
     , m_nMCHitsW(0)
     , m_energy(0.f)
     , m_nMatchedPfos(0)
+    , m_tableIndex(-1)
     , m_pAddress(nullptr)
   {}
 
@@ -1005,4 +1263,69 @@ namespace lar_pandora {
     : m_matchedPrimaryId(-1), m_nMatchedHits(0), m_completeness(0.f)
   {}
 
+  //------------------------------------------------------------------------------------------------------------------------------------------
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  PFParticleValidation::MatchingConfig::MatchingConfig()
+    : m_neutrinoInducedOnly(true)
+    , m_matchingMinPrimaryHits(15)
+    , m_matchingMinHitsForGoodView(5)
+    , m_matchingMinPrimaryGoodViews(2)
+    , m_useSmallPrimaries(true)
+    , m_matchingMinSharedHits(5)
+    , m_matchingMinCompleteness(0.1f)
+    , m_matchingMinPurity(0.5f)
+  {}
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  PFParticleValidation::MatchingSummary::MatchingSummary()
+    : m_nEvents(0)
+    , m_nCalculableEvents(0)
+    , m_nCorrectEvents(0)
+    , m_nTargetPrimaries(0)
+    , m_nCorrectTargetPrimaries(0)
+  {}
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  PFParticleValidation::HitCounts::HitCounts()
+    : m_nHitsTotal(0), m_nHitsU(0), m_nHitsV(0), m_nHitsW(0)
+  {}
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  void PFParticleValidation::HitCounts::AddHit(const geo::View_t view)
+  {
+    ++m_nHitsTotal;
+
+    if (geo::kU == view)
+      ++m_nHitsU;
+    else if (geo::kV == view)
+      ++m_nHitsV;
+    else if (geo::kW == view)
+      ++m_nHitsW;
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  PFParticleValidation::HitCounts& PFParticleValidation::MCParticleMatchingTable::GetSharedHits(
+    const unsigned int mcIndex,
+    const unsigned int pfoIndex)
+  {
+    return m_sharedHits[static_cast<size_t>(mcIndex) * m_pfos.size() + pfoIndex];
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  const PFParticleValidation::HitCounts&
+  PFParticleValidation::MCParticleMatchingTable::GetSharedHits(const unsigned int mcIndex,
+                                                              const unsigned int pfoIndex) const
+  {
+    return m_sharedHits[static_cast<size_t>(mcIndex) * m_pfos.size() + pfoIndex];
+  }
+
 } //namespace lar_pandora
@@ -21,6 +21,7 @@
 #include "TStyle.h"
 
 #include <memory>
+#include <unordered_map>
 
 shower::LArPandoraShowerAlg::LArPandoraShowerAlg(const fhicl::ParameterSet& pset)
   : fUseCollectionOnly(pset.get<bool>("UseCollectionOnly"))
@@ -33,6 +34,37 @@ shower::LArPandoraShowerAlg::LArPandoraShowerAlg(const fhicl::ParameterSet& pset
   , fInitialTrackSpacePointsInputLabel(pset.get<std::string>("InitialTrackSpacePointsInputLabel"))
 {}
 
+shower::ShowerChargeCorrections::ShowerChargeCorrections(
+  detinfo::DetectorClocksData const& clockData,
+  detinfo::DetectorPropertiesData const& detProp,
+  bool tabulateTicks)
+  : fLifetimeExponent(sampling_rate(clockData) / (detProp.ElectronLifetime() * 1e3))
+{
+  // The sub-tick factor is expanded to third order below, only tabulate if that is exact
+  // to well below float precision
+  if (!tabulateTicks || std::abs(fLifetimeExponent) > 1e-2) return;
+
+  const unsigned int nTicks(detProp.NumberTimeSamples());
+  fLifetimeTable.reserve(nTicks + 1);
+  for (unsigned int tick = 0; tick <= nTicks; ++tick) {
+    fLifetimeTable.push_back(std::exp(fLifetimeExponent * tick));
+  }
+}
+
+double shower::ShowerChargeCorrections::LifetimeCorrection(double tick) const
+{
+  if (tick < 0 || tick >= fLifetimeTable.size()) return std::exp(fLifetimeExponent * tick);
+
+  const unsigned int intTick(static_cast<unsigned int>(tick));
+  const double subTick(fLifetimeExponent * (tick - intTick));
+  return fLifetimeTable[intTick] * (1. + subTick * (1. + subTick * (0.5 + subTick / 6.)));
+}
+
+double shower::ShowerChargeCorrections::CorrectedIntegral(recob::Hit const& hit) const
+{
+  return hit.Integral() * LifetimeCorrection(hit.PeakTime());
+}
+
 //Order the shower hits with regards to their projected length onto
 //the shower direction from the shower start position. This is done
 //in the 2D coordinate system (wire direction, x)
@@ -217,16 +249,39 @@ geo::Point_t shower::LArPandoraShowerAlg::ShowerCentre(
     clockData, detProp, showerspcs, fmh, totalCharge);
 }
 
-//Returns the vector to the shower centre and the total charge of the shower.
 geo::Point_t shower::LArPandoraShowerAlg::ShowerCentre(
   detinfo::DetectorClocksData const& clockData,
   detinfo::DetectorPropertiesData const& detProp,
   std::vector<art::Ptr<recob::SpacePoint>> const& showersps,
   art::FindManyP<recob::Hit> const& fmh,
   float& totalCharge) const
+{
+  // One-off call so don't pay for the tick table
+  const shower::ShowerChargeCorrections corrections(clockData, detProp, false);
+  return shower::LArPandoraShowerAlg::ShowerCentre(corrections, showersps, fmh, totalCharge);
+}
+
+geo::Point_t shower::LArPandoraShowerAlg::ShowerCentre(
+  shower::ShowerChargeCorrections const& corrections,
+  std::vector<art::Ptr<recob::SpacePoint>> const& showersps,
+  art::FindManyP<recob::Hit> const& fmh) const
+{
+  float totalCharge = 0;
+  return shower::LArPandoraShowerAlg::ShowerCentre(corrections, showersps, fmh, totalCharge);
+}
+
+//Returns the vector to the shower centre and the total charge of the shower.
+geo::Point_t shower::LArPandoraShowerAlg::ShowerCentre(
+  shower::ShowerChargeCorrections const& corrections,
+  std::vector<art::Ptr<recob::SpacePoint>> const& showersps,
+  art::FindManyP<recob::Hit> const& fmh,
+  float& totalCharge) const
 {
   geo::Point_t chargePoint{};
 
+  //Corrected hit charges, reused for the mean and the truncated sum.
+  std::vector<double> hitCharges;
+
   //Loop over the spacepoints and get the charge weighted center.
   for (auto const& sp : showersps) {
 
@@ -236,22 +291,21 @@ geo::Point_t shower::LArPandoraShowerAlg::ShowerCentre(
     //Average the charge unless sepcified.
     float charge = 0;
     float charge2 = 0;
+    hitCharges.clear();
     for (auto const& hit : hits) {
 
       if (fUseCollectionOnly) {
         if (hit->SignalType() == geo::kCollection) {
-          charge = hit->Integral();
           //Correct for the lifetime: Need to do other detproperites
-          charge *= std::exp((sampling_rate(clockData) * hit->PeakTime()) /
-                             (detProp.ElectronLifetime() * 1e3));
+          charge = corrections.CorrectedIntegral(*hit);
           break;
         }
       }
       else {
 
         //Correct for the lifetime FIX: Need  to do other detproperties somehow
-        double Q = hit->Integral() * std::exp((sampling_rate(clockData) * hit->PeakTime()) /
-                                              (detProp.ElectronLifetime() * 1e3));
+        double Q = corrections.CorrectedIntegral(*hit);
+        hitCharges.push_back(Q);
 
         charge += Q;
         charge2 += Q * Q;
@@ -270,12 +324,9 @@ geo::Point_t shower::LArPandoraShowerAlg::ShowerCentre(
 
       charge = 0;
       int n = 0;
-      for (auto const& hit : hits) {
-        double lifetimecorrection = std::exp((sampling_rate(clockData) * hit->PeakTime()) /
-                                             (detProp.ElectronLifetime() * 1e3));
-        if (hit->Integral() * lifetimecorrection > (mean - 2 * rms) &&
-            hit->Integral() * lifetimecorrection < (mean + 2 * rms)) {
-          charge += hit->Integral() * lifetimecorrection;
+      for (double const Q : hitCharges) {
+        if (Q > (mean - 2 * rms) && Q < (mean + 2 * rms)) {
+          charge += Q;
           ++n;
         }
       }
@@ -347,6 +398,15 @@ double shower::LArPandoraShowerAlg::SpacePointTime(art::Ptr<recob::SpacePoint> c
   return Time;
 }
 
+//Return the spacepoint charge corrected for the lifetime at the spacepoint time.
+double shower::LArPandoraShowerAlg::SpacePointCorrectedCharge(
+  art::Ptr<recob::SpacePoint> const& sp,
+  art::FindManyP<recob::Hit> const& fmh,
+  shower::ShowerChargeCorrections const& corrections) const
+{
+  return SpacePointCharge(sp, fmh) * corrections.LifetimeCorrection(SpacePointTime(sp, fmh));
+}
+
 //Return the cooordinates of the hit in cm in wire direction and x.
 TVector2 shower::LArPandoraShowerAlg::HitCoordinates(detinfo::DetectorPropertiesData const& detProp,
                                                      art::Ptr<recob::Hit> const& hit) const
@@ -534,56 +594,61 @@ shower::LArPandoraShowerAlg::OrganizeHits(const std::vector<art::Ptr<recob::Hit>
   // If there are multiple valid hits on the same snippet, we need a way to pick the best one.
   // (TODO: find a good way). The current method is to take the one with the highest charge integral.
   typedef std::pair<unsigned, std::vector<unsigned>> OrganizedHits;
-  struct HitIdentifier {
+
+  // Hits on the same plane are on the same snippet if they share the wire and tick range
+  struct SnippetKey {
+    int wire;
     int startTick;
     int endTick;
-    int wire;
-    float integral;
-
-    // construct
-    explicit HitIdentifier(const recob::Hit& hit)
-      : startTick(hit.StartTick())
-      , endTick(hit.EndTick())
-      , wire(hit.WireID().Wire)
-      , integral(hit.Integral())
-    {}
-
-    // Defines whether two hits are on the same snippet
-    inline bool operator==(const HitIdentifier& rhs) const
+
+    inline bool operator==(const SnippetKey& rhs) const
     {
-      return startTick == rhs.startTick && endTick == rhs.endTick && wire == rhs.wire;
+      return wire == rhs.wire && startTick == rhs.startTick && endTick == rhs.endTick;
+    }
+  };
+  struct SnippetKeyHash {
+    std::size_t operator()(const SnippetKey& key) const
+    {
+      std::size_t seed = std::hash<int>()(key.wire);
+      seed ^= std::hash<int>()(key.startTick) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+      seed ^= std::hash<int>()(key.endTick) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+      return seed;
     }
-
-    // Defines which hit to pick between two both on the same snippet
-    inline bool operator>(const HitIdentifier& rhs) const { return integral > rhs.integral; }
   };
 
-  unsigned nplanes = 6; // TODO FIXME
+  // For each plane, the organised hits and the integral of the current primary hit, plus a
+  // lookup from each snippet to its position in the organised hits
+  const unsigned nplanes = fGeom->MaxPlanes();
   std::vector<std::vector<OrganizedHits>> hits_org(nplanes);
-  std::vector<std::vector<HitIdentifier>> hit_idents(nplanes);
+  std::vector<std::vector<float>> primary_integrals(nplanes);
+  std::vector<std::unordered_map<SnippetKey, unsigned, SnippetKeyHash>> snippets(nplanes);
   for (unsigned i = 0; i < hits.size(); i++) {
-    HitIdentifier this_ident(*hits[i]);
+    const recob::Hit& hit = *hits[i];
+    const unsigned plane = hit.WireID().Plane;
+    if (plane >= nplanes) {
+      throw cet::exception("LArPandoraShowerAlg")
+        << "Hit on plane " << plane << " but the geometry has at most " << nplanes << " planes";
+    }
+    const SnippetKey key{(int)hit.WireID().Wire, hit.StartTick(), hit.EndTick()};
 
     // check if we have found a hit on this snippet before
-    bool found_snippet = false;
-    for (unsigned j = 0; j < hits_org[hits[i]->WireID().Plane].size(); j++) {
-      if (this_ident == hit_idents[hits[i]->WireID().Plane][j]) {
-        found_snippet = true;
-        if (this_ident > hit_idents[hits[i]->WireID().Plane][j]) {
-          hits_org[hits[i]->WireID().Plane][j].second.push_back(
-            hits_org[hits[i]->WireID().Plane][j].first);
-          hits_org[hits[i]->WireID().Plane][j].first = i;
-          hit_idents[hits[i]->WireID().Plane][j] = this_ident;
-        }
-        else {
-          hits_org[hits[i]->WireID().Plane][j].second.push_back(i);
-        }
-        break;
-      }
+    auto const [snippetIter, newSnippet] = snippets[plane].try_emplace(key, hits_org[plane].size());
+    if (newSnippet) {
+      hits_org[plane].push_back({i, {}});
+      primary_integrals[plane].push_back(hit.Integral());
+      continue;
     }
-    if (!found_snippet) {
-      hits_org[hits[i]->WireID().Plane].push_back({i, {}});
-      hit_idents[hits[i]->WireID().Plane].push_back(this_ident);
+
+    // If there are multiple hits on the snippet, the one with the highest integral is primary
+    OrganizedHits& hit_org = hits_org[plane][snippetIter->second];
+    float& primary_integral = primary_integrals[plane][snippetIter->second];
+    if (hit.Integral() > primary_integral) {
+      hit_org.second.push_back(hit_org.first);
+      hit_org.first = i;
+      primary_integral = hit.Integral();
+    }
+    else {
+      hit_org.second.push_back(i);
     }
   }
   std::map<art::Ptr<recob::Hit>, std::vector<art::Ptr<recob::Hit>>> ret;
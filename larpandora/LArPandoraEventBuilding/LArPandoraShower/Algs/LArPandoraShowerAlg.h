@@ -35,8 +35,28 @@ namespace spacecharge {
 
 namespace shower {
   class LArPandoraShowerAlg;
+  class ShowerChargeCorrections;
 }
 
+// Per-event hit charge correction factors. The electron lifetime exponential is tabulated
+// once per readout tick so that iterative tools which repeatedly charge weight the same hits
+// do not need to re-evaluate it for every hit on every call.
+class shower::ShowerChargeCorrections {
+public:
+  // If tabulateTicks is false, no tick table is built and the lifetime correction is evaluated
+  // directly; this is cheaper for one-off calls.
+  ShowerChargeCorrections(detinfo::DetectorClocksData const& clockData,
+                          detinfo::DetectorPropertiesData const& detProp,
+                          bool tabulateTicks = true);
+
+  double LifetimeCorrection(double tick) const;
+  double CorrectedIntegral(recob::Hit const& hit) const;
+
+private:
+  double fLifetimeExponent;           // Lifetime correction exponent per tick
+  std::vector<double> fLifetimeTable; // Lifetime correction at each integer tick
+};
+
 class shower::LArPandoraShowerAlg {
 public:
   explicit LArPandoraShowerAlg(const fhicl::ParameterSet& pset);
@@ -70,6 +90,15 @@ public:
                             std::vector<art::Ptr<recob::SpacePoint>> const& showerspcs,
                             art::FindManyP<recob::Hit> const& fmh) const;
 
+  geo::Point_t ShowerCentre(shower::ShowerChargeCorrections const& corrections,
+                            std::vector<art::Ptr<recob::SpacePoint>> const& showersps,
+                            art::FindManyP<recob::Hit> const& fmh,
+                            float& totalCharge) const;
+
+  geo::Point_t ShowerCentre(shower::ShowerChargeCorrections const& corrections,
+                            std::vector<art::Ptr<recob::SpacePoint>> const& showersps,
+                            art::FindManyP<recob::Hit> const& fmh) const;
+
   double DistanceBetweenSpacePoints(art::Ptr<recob::SpacePoint> const& sp_a,
                                     art::Ptr<recob::SpacePoint> const& sp_b) const;
 
@@ -79,6 +108,11 @@ public:
   double SpacePointTime(art::Ptr<recob::SpacePoint> const& sp,
                         art::FindManyP<recob::Hit> const& fmh) const;
 
+  // Spacepoint charge corrected for the lifetime at the average hit time
+  double SpacePointCorrectedCharge(art::Ptr<recob::SpacePoint> const& sp,
+                                   art::FindManyP<recob::Hit> const& fmh,
+                                   shower::ShowerChargeCorrections const& corrections) const;
+
   TVector2 HitCoordinates(detinfo::DetectorPropertiesData const& detProp,
                           art::Ptr<recob::Hit> const& hit) const;
 
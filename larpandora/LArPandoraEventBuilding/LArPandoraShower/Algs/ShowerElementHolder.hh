@@ -497,6 +497,19 @@ public:
     return checked;
   }
 
+  //Number of shower properties and data products that are currently set
+  unsigned int NumSetElements() const
+  {
+    unsigned int nSet = 0;
+    for (auto const& showerprop : showerproperties) {
+      if (showerprop.second->CheckShowerElement()) ++nSet;
+    }
+    for (auto const& showerdataprod : showerdataproducts) {
+      if (showerdataprod.second->CheckShowerElement()) ++nSet;
+    }
+    return nSet;
+  }
+
   //Clear Fucntion. This does not delete the element.
   void ClearElement(const std::string& Name)
   {
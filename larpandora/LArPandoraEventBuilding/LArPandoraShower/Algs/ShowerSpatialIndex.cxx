@@ -0,0 +1,71 @@
+#include "larpandora/LArPandoraEventBuilding/LArPandoraShower/Algs/ShowerSpatialIndex.h"
+
+#include <cmath>
+#include <limits>
+
+shower::ShowerSpatialIndex::ShowerSpatialIndex(std::vector<geo::Point_t> const& points,
+                                               double voxelSize)
+  : fVoxelSize(voxelSize > std::numeric_limits<double>::epsilon() ? voxelSize : 1.)
+  , fPoints(points)
+{
+  for (std::size_t index = 0; index < fPoints.size(); ++index) {
+    geo::Point_t const& point = fPoints[index];
+    fVoxels[VoxelKey(VoxelCoordinate(point.X()),
+                     VoxelCoordinate(point.Y()),
+                     VoxelCoordinate(point.Z()))]
+      .push_back(index);
+  }
+}
+
+std::size_t shower::ShowerSpatialIndex::NearestPoint(geo::Point_t const& pos,
+                                                     double maxDist) const
+{
+  std::size_t nearest = fPoints.size();
+  double minDist = maxDist;
+
+  auto const testPoint = [&](std::size_t const index) {
+    double const dist = (pos - fPoints[index]).R();
+    if (dist < minDist || (dist == minDist && nearest != fPoints.size() && index < nearest)) {
+      minDist = dist;
+      nearest = index;
+    }
+  };
+
+  const int minX(VoxelCoordinate(pos.X() - maxDist)), maxX(VoxelCoordinate(pos.X() + maxDist));
+  const int minY(VoxelCoordinate(pos.Y() - maxDist)), maxY(VoxelCoordinate(pos.Y() + maxDist));
+  const int minZ(VoxelCoordinate(pos.Z() - maxDist)), maxZ(VoxelCoordinate(pos.Z() + maxDist));
+
+  // If the search volume covers more voxels than there are filled ones just scan them all
+  const double nSearchVoxels(static_cast<double>(maxX - minX + 1) * (maxY - minY + 1) *
+                             (maxZ - minZ + 1));
+  if (nSearchVoxels > fVoxels.size()) {
+    for (std::size_t index = 0; index < fPoints.size(); ++index)
+      testPoint(index);
+    return nearest;
+  }
+
+  for (int ix = minX; ix <= maxX; ++ix) {
+    for (int iy = minY; iy <= maxY; ++iy) {
+      for (int iz = minZ; iz <= maxZ; ++iz) {
+        auto const voxelIter = fVoxels.find(VoxelKey(ix, iy, iz));
+        if (voxelIter == fVoxels.end()) continue;
+        for (std::size_t const index : voxelIter->second)
+          testPoint(index);
+      }
+    }
+  }
+  return nearest;
+}
+
+int shower::ShowerSpatialIndex::VoxelCoordinate(double x) const
+{
+  return static_cast<int>(std::floor(x / fVoxelSize));
+}
+
+std::int64_t shower::ShowerSpatialIndex::VoxelKey(int ix, int iy, int iz) const
+{
+  // 21 bits per coordinate is plenty for any detector at sub-cm voxel sizes
+  constexpr std::int64_t mask = (std::int64_t{1} << 21) - 1;
+  return ((static_cast<std::int64_t>(ix) & mask) << 42) |
+         ((static_cast<std::int64_t>(iy) & mask) << 21) | (static_cast<std::int64_t>(iz) & mask);
+}
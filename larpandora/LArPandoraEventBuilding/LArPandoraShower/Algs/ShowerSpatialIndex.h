@@ -0,0 +1,36 @@
+#ifndef ShowerSpatialIndex_hxx
+#define ShowerSpatialIndex_hxx
+
+#include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h"
+
+//C++ Includes
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace shower {
+  class ShowerSpatialIndex;
+}
+
+// Voxel grid over a set of 3D points (spacepoints, trajectory points) so that proximity queries
+// only look at the points in the neighbouring voxels rather than scanning the full set.
+class shower::ShowerSpatialIndex {
+public:
+  ShowerSpatialIndex(std::vector<geo::Point_t> const& points, double voxelSize);
+
+  // Index of the closest point strictly within maxDist of pos, ties going to the lowest index.
+  // Returns NPoints() if there is no such point.
+  std::size_t NearestPoint(geo::Point_t const& pos, double maxDist) const;
+
+  std::size_t NPoints() const { return fPoints.size(); }
+
+private:
+  int VoxelCoordinate(double x) const;
+  std::int64_t VoxelKey(int ix, int iy, int iz) const;
+
+  double fVoxelSize;
+  std::vector<geo::Point_t> fPoints;
+  std::unordered_map<std::int64_t, std::vector<std::size_t>> fVoxels;
+};
+
+#endif
@@ -28,6 +28,14 @@
 #include "lardataobj/RecoBase/SpacePoint.h"
 #include "larpandora/LArPandoraEventBuilding/LArPandoraShower/Tools/IShowerTool.h"
 
+#include "art_root_io/TFileService.h"
+
+//Root includes
+#include "TTree.h"
+
+//C++ includes
+#include <chrono>
+
 namespace reco::shower {
   class LArPandoraModularShowerCreation;
 }
@@ -39,7 +47,17 @@ public:
   LArPandoraModularShowerCreation(fhicl::ParameterSet const& pset);
 
 private:
+  void beginJob();
   void produce(art::Event& evt);
+  void endJob();
+
+  //Per tool summary of the profiling information
+  struct ToolProfile {
+    unsigned int nCalls = 0;
+    unsigned int nFailures = 0;
+    unsigned int nElements = 0;
+    double totalTime = 0; // ms
+  };
 
   //This function returns the art::Ptr to the data object InstanceName.
   //In the background it uses the PtrMaker which requires the element index of
@@ -55,6 +73,7 @@ private:
   const bool fAllowPartialShowers;
   const int fVerbose;
   const bool fUseAllParticles;
+  const bool fProfileTools;
 
   //tool tags which calculate the characteristics of the shower
   const std::string fShowerStartPositionLabel;
@@ -72,6 +91,19 @@ private:
   //map to the unique ptrs to
   reco::shower::ShowerProducedPtrsHolder uniqueproducerPtrs;
 
+  //Tool profiling, only filled if requested
+  std::vector<ToolProfile> fToolProfiles;
+  TTree* fProfileTree;
+  int fRun;
+  int fSubRun;
+  int fEvent;
+  int fShowerIndex;
+  int fToolIndex;
+  std::string fToolName;
+  double fToolTime;
+  int fToolReturnCode;
+  int fToolNumElements;
+
   // Required services
   art::ServiceHandle<geo::Geometry> fGeom;
 };
@@ -117,6 +149,7 @@ reco::shower::LArPandoraModularShowerCreation::LArPandoraModularShowerCreation(
   , fAllowPartialShowers(pset.get<bool>("AllowPartialShowers"))
   , fVerbose(pset.get<int>("Verbose", 0))
   , fUseAllParticles(pset.get<bool>("UseAllParticles", false))
+  , fProfileTools(pset.get<bool>("ProfileTools", false))
   , fShowerStartPositionLabel(pset.get<std::string>("ShowerStartPositionLabel"))
   , fShowerDirectionLabel(pset.get<std::string>("ShowerDirectionLabel"))
   , fShowerEnergyLabel(pset.get<std::string>("ShowerEnergyLabel"))
@@ -196,6 +229,40 @@ reco::shower::LArPandoraModularShowerCreation::LArPandoraModularShowerCreation(
                                                "pfShowerAssociationsbase");
 
   uniqueproducerPtrs.PrintPtrs();
+
+  fToolProfiles.resize(fShowerTools.size());
+}
+
+void reco::shower::LArPandoraModularShowerCreation::beginJob()
+{
+  if (!fProfileTools) return;
+
+  art::ServiceHandle<art::TFileService> tfs;
+  fProfileTree = tfs->make<TTree>("ToolProfile", "Time and outcome of each shower tool call");
+  fProfileTree->Branch("run", &fRun, "run/I");
+  fProfileTree->Branch("subrun", &fSubRun, "subrun/I");
+  fProfileTree->Branch("event", &fEvent, "event/I");
+  fProfileTree->Branch("shower", &fShowerIndex, "shower/I");
+  fProfileTree->Branch("tool", &fToolIndex, "tool/I");
+  fProfileTree->Branch("toolName", &fToolName);
+  fProfileTree->Branch("time", &fToolTime, "time/D");
+  fProfileTree->Branch("returnCode", &fToolReturnCode, "returnCode/I");
+  fProfileTree->Branch("nElements", &fToolNumElements, "nElements/I");
+}
+
+void reco::shower::LArPandoraModularShowerCreation::endJob()
+{
+  if (!fProfileTools) return;
+
+  mf::LogInfo log("LArPandoraModularShowerCreation");
+  log << "Shower tool profile (tool, calls, failures, elements set, total time [ms], "
+         "mean time [ms]):";
+  for (unsigned int i = 0; i < fShowerTools.size(); ++i) {
+    const ToolProfile& profile = fToolProfiles[i];
+    log << "\n  " << i << " " << fShowerToolNames[i] << ": " << profile.nCalls << ", "
+        << profile.nFailures << ", " << profile.nElements << ", " << profile.totalTime << ", "
+        << (profile.nCalls ? profile.totalTime / profile.nCalls : 0.);
+  }
 }
 
 void reco::shower::LArPandoraModularShowerCreation::produce(art::Event& evt)
@@ -261,10 +328,42 @@ void reco::shower::LArPandoraModularShowerCreation::produce(art::Event& evt)
       if (fVerbose > 1)
         mf::LogInfo("LArPandoraModularShowerCreation")
           << "Running shower tool: " << fShowerToolNames[i] << std::endl;
-      std::string evd_disp_append = fShowerToolNames[i] + "_iteration" + std::to_string(0) + "_" +
-                                    this->moduleDescription().moduleLabel();
+      //Only build the display name if there will be a display
+      std::string evd_disp_append;
+      if (fShowerTools[i]->RunEventDisplay()) {
+        evd_disp_append = fShowerToolNames[i] + "_iteration" + std::to_string(0) + "_" +
+                          this->moduleDescription().moduleLabel();
+      }
 
-      err = fShowerTools[i]->RunShowerTool(pfp, evt, showerEleHolder, evd_disp_append);
+      if (fProfileTools) {
+        const unsigned int nElementsBefore = showerEleHolder.NumSetElements();
+        const auto startTime = std::chrono::steady_clock::now();
+
+        err = fShowerTools[i]->RunShowerTool(pfp, evt, showerEleHolder, evd_disp_append);
+
+        const std::chrono::duration<double, std::milli> toolTime =
+          std::chrono::steady_clock::now() - startTime;
+
+        fRun = evt.run();
+        fSubRun = evt.subRun();
+        fEvent = evt.event();
+        fShowerIndex = shower_iter;
+        fToolIndex = i;
+        fToolName = fShowerToolNames[i];
+        fToolTime = toolTime.count();
+        fToolReturnCode = err;
+        fToolNumElements = (int)showerEleHolder.NumSetElements() - (int)nElementsBefore;
+        fProfileTree->Fill();
+
+        ToolProfile& profile = fToolProfiles[i];
+        ++profile.nCalls;
+        if (err) ++profile.nFailures;
+        if (fToolNumElements > 0) profile.nElements += fToolNumElements;
+        profile.totalTime += fToolTime;
+      }
+      else {
+        err = fShowerTools[i]->RunShowerTool(pfp, evt, showerEleHolder, evd_disp_append);
+      }
 
       if (err && fVerbose) {
         mf::LogError("LArPandoraModularShowerCreation")
@@ -58,6 +58,9 @@ namespace ShowerRecoTools {
       return calculation_status;
     }
 
+    //Whether the debug event display is drawn after the tool runs
+    bool RunEventDisplay() const { return fRunEventDisplay; }
+
     //Function to initialise the producer i.e produces<std::vector<recob::Vertex> >(); commands go here.
     virtual void InitialiseProducers() {}
 
@@ -114,13 +114,13 @@ namespace ShowerRecoTools {
       return 1;
     }
 
-    // Order the spacepoints
-    IShowerTool::GetLArPandoraShowerAlg().OrderShowerSpacePoints(
-      spacePoints, ShowerStartPosition, ShowerDirection);
-
     // Get only the space points from the track
     auto trackSpacePoints = FindTrackSpacePoints(spacePoints, ShowerStartPosition, ShowerDirection);
 
+    // Order the track spacepoints, no need to sort the rest of the shower
+    IShowerTool::GetLArPandoraShowerAlg().OrderShowerSpacePoints(
+      trackSpacePoints, ShowerStartPosition, ShowerDirection);
+
     // Get the hits associated to the space points and seperate them by planes
     std::vector<art::Ptr<recob::Hit>> trackHits;
     for (auto const& spacePoint : trackSpacePoints) {
@@ -149,13 +149,16 @@ namespace ShowerRecoTools {
       // from "axis" of shower TODO: change alg to return a pair for efficiency
       double proj = IShowerTool::GetLArPandoraShowerAlg().SpacePointProjection(
         spacePoint, showerStartPosition, showerDirection);
-      double perp = IShowerTool::GetLArPandoraShowerAlg().SpacePointPerpendicular(
-        spacePoint, showerStartPosition, showerDirection, proj);
 
       if (fForwardHitsOnly && proj < 0) continue;
 
-      if (std::abs(proj) < fMaxProjectionDist && std::abs(perp) < fMaxPerpendicularDist)
-        trackSpacePoints.push_back(spacePoint);
+      // Only need the perpendicular distance if we are inside the cylinder length
+      if (std::abs(proj) >= fMaxProjectionDist) continue;
+
+      double perp = IShowerTool::GetLArPandoraShowerAlg().SpacePointPerpendicular(
+        spacePoint, showerStartPosition, showerDirection, proj);
+
+      if (std::abs(perp) < fMaxPerpendicularDist) trackSpacePoints.push_back(spacePoint);
     }
     return trackSpacePoints;
   }
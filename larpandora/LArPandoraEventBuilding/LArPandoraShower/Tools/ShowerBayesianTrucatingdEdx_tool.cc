@@ -34,12 +34,41 @@ namespace ShowerRecoTools {
                          reco::shower::ShowerElementHolder& ShowerEleHolder) override;
 
   private:
-    double CalculatePosterior(std::string priorname,
-                              std::vector<double>& values,
-                              int& minprob,
+    enum Prior { kElectron = 0, kPhoton = 1, kNumPriors = 2 };
+
+    //Prior histogram flattened into arrays at construction, indexed by histogram bin
+    struct PriorTable {
+      int nBins;
+      double xMin;
+      double xMax;
+      std::vector<double> binEdges; //Only filled for variable binning
+      std::vector<float> prob;      //Probability as used in the posterior
+      std::vector<double> logProb;  //Log of the above
+      std::vector<float> pointProb; //Probability as used for the single point cut
+    };
+
+    //Running likelihood sums of a set of dEdx values, kept per prior so that adding a value
+    //to the track only costs one lookup per prior.
+    struct TrackLikelihood {
+      double logLikelihood[kNumPriors] = {0, 0};      //Log likelihood under the prior
+      double logLikelihoodOther[kNumPriors] = {0, 0}; //Log likelihood under the other prior
+      float probSum[kNumPriors] = {0, 0};
+    };
+
+    PriorTable MakePriorTable(TH1F const& hist) const;
+
+    int FindBin(Prior prior, double value) const;
+
+    //Add a value to the running sums under each prior
+    void AddValue(TrackLikelihood& likelihood, double value) const;
+
+    double CalculatePosterior(Prior prior, TrackLikelihood const& likelihood) const;
+
+    double CalculatePosterior(Prior prior,
+                              std::vector<double> const& values,
+                              int& minprob_iter,
                               float& mean,
-                              float& likelihood);
-    double CalculatePosterior(std::string priorname, std::vector<double>& values);
+                              TrackLikelihood& likelihood) const;
 
     bool isProbabilityGood(float& old_prob, float& new_prob)
     {
@@ -51,29 +80,27 @@ namespace ShowerRecoTools {
       return (old_posteior - prob) < fPostiorCut;
     }
 
-    bool CheckPoint(std::string priorname, double& value);
+    bool CheckPoint(Prior prior, double value) const;
 
     std::vector<double> GetLikelihooddEdxVec(double& electronprob,
                                              double& photonprob,
-                                             std::string prior,
-                                             std::vector<double>& dEdxVec);
+                                             Prior prior,
+                                             std::vector<double> const& dEdxVec) const;
 
-    std::vector<double> MakeSeed(std::vector<double>& dEdxVec);
+    std::vector<double> MakeSeed(std::vector<double> const& dEdxVec) const;
 
     void ForceSeedToFit(std::vector<double>& SeedTrack,
-                        std::string& prior,
+                        Prior prior,
                         float& mean,
-                        double& posterior);
+                        double& posterior,
+                        TrackLikelihood& likelihood) const;
 
     void RecurivelyAddHit(std::vector<double>& SeedTrack,
-                          std::vector<double>& dEdxVec,
-                          std::string& prior,
-                          int& SkippedHitsNum,
-                          float& old_mean,
-                          double& old_posteior);
+                          std::vector<double> const& dEdxVec,
+                          Prior prior,
+                          TrackLikelihood& likelihood) const;
 
-    TH1F* electronpriorHist;
-    TH1F* photonpriorHist;
+    PriorTable fPriorTables[kNumPriors];
 
     //fcl params
     int fVerbose;
@@ -118,11 +145,11 @@ namespace ShowerRecoTools {
     }
 
     //Get the histograms.
-    electronpriorHist = dynamic_cast<TH1F*>(fin.Get(electron_histoname.c_str()));
+    TH1F* electronpriorHist = dynamic_cast<TH1F*>(fin.Get(electron_histoname.c_str()));
     if (!electronpriorHist) {
       throw cet::exception("ShowerBayesianTrucatingdEdx") << "Could not read the electron hist";
     }
-    photonpriorHist = dynamic_cast<TH1F*>(fin.Get(photon_histoname.c_str()));
+    TH1F* photonpriorHist = dynamic_cast<TH1F*>(fin.Get(photon_histoname.c_str()));
     if (!photonpriorHist) {
       throw cet::exception("ShowerBayesianTrucatingdEdx") << "Could not read the photon hist ";
     }
@@ -134,6 +161,10 @@ namespace ShowerRecoTools {
     //Normalise the histograms.
     electronpriorHist->Scale(1 / electronpriorHist->Integral());
     photonpriorHist->Scale(1 / photonpriorHist->Integral());
+
+    //Flatten the priors, the histograms belong to the file and go when it closes.
+    fPriorTables[kElectron] = MakePriorTable(*electronpriorHist);
+    fPriorTables[kPhoton] = MakePriorTable(*photonpriorHist);
   }
 
   int ShowerBayesianTrucatingdEdx::CalculateElement(
@@ -170,7 +201,7 @@ namespace ShowerRecoTools {
         continue;
       }
 
-      std::vector<double> dEdx_vec = dEdx_vec_plane.second;
+      std::vector<double> const& dEdx_vec = dEdx_vec_plane.second;
 
       double electronprob_eprior = 0;
       double photonprob_eprior = 0;
@@ -179,9 +210,9 @@ namespace ShowerRecoTools {
       double photonprob_pprior = 0;
 
       std::vector<double> dEdx_electronprior =
-        GetLikelihooddEdxVec(electronprob_eprior, photonprob_eprior, "electron", dEdx_vec);
+        GetLikelihooddEdxVec(electronprob_eprior, photonprob_eprior, kElectron, dEdx_vec);
       std::vector<double> dEdx_photonprior =
-        GetLikelihooddEdxVec(electronprob_pprior, photonprob_pprior, "photon", dEdx_vec);
+        GetLikelihooddEdxVec(electronprob_pprior, photonprob_pprior, kPhoton, dEdx_vec);
 
       //Use the vector which maximises both priors.
       if (electronprob_eprior < photonprob_pprior) {
@@ -230,178 +261,158 @@ namespace ShowerRecoTools {
     return 0;
   }
 
-  double ShowerBayesianTrucatingdEdx::CalculatePosterior(std::string priorname,
-                                                         std::vector<double>& values)
+  ShowerBayesianTrucatingdEdx::PriorTable ShowerBayesianTrucatingdEdx::MakePriorTable(
+    TH1F const& hist) const
   {
-    int minprob_iter = -999;
-    float mean = -999;
-    float likelihood = -999;
-    return CalculatePosterior(priorname, values, minprob_iter, mean, likelihood);
+    TAxis const* xaxis = hist.GetXaxis();
+
+    PriorTable table;
+    table.nBins = xaxis->GetNbins();
+    table.xMin = xaxis->GetXmin();
+    table.xMax = xaxis->GetXmax();
+
+    TArrayD const* xbins = xaxis->GetXbins();
+    if (xbins->GetSize()) {
+      table.binEdges.assign(xbins->GetArray(), xbins->GetArray() + xbins->GetSize());
+    }
+
+    //Include the under and overflow bins. The posterior has always treated the last bin, and
+    //the single point check the overflow bin, as having zero probability.
+    for (int bin = 0; bin <= table.nBins + 1; ++bin) {
+      const float content = hist.GetBinContent(bin);
+      const float prob = bin == table.nBins ? 0 : content;
+      table.prob.push_back(prob);
+      table.logProb.push_back(std::log(prob));
+      table.pointProb.push_back(bin == table.nBins + 1 ? 0 : content);
+    }
+    return table;
   }
 
-  double ShowerBayesianTrucatingdEdx::CalculatePosterior(std::string priorname,
-                                                         std::vector<double>& values,
-                                                         int& minprob_iter,
-                                                         float& mean,
-                                                         float& likelihood)
+  //Same binning as TAxis::FindBin without going back to the histogram.
+  int ShowerBayesianTrucatingdEdx::FindBin(Prior prior, double value) const
   {
+    PriorTable const& table = fPriorTables[prior];
 
-    //Posterior prob;
-    float posterior = 1;
-    float meanprob = 0;
-    float likelihood_other = 1;
-    likelihood = 1;
+    if (value < table.xMin) return 0;
+    if (!(value < table.xMax)) return table.nBins + 1;
+    if (table.binEdges.empty()) {
+      return 1 + int(table.nBins * (value - table.xMin) / (table.xMax - table.xMin));
+    }
+    return std::upper_bound(table.binEdges.begin(), table.binEdges.end(), value) -
+           table.binEdges.begin();
+  }
 
-    //Minimum probability temp
-    float minprob_temp = 9999;
-    minprob_iter = 0;
+  void ShowerBayesianTrucatingdEdx::AddValue(TrackLikelihood& likelihood, double value) const
+  {
+    for (int prior = 0; prior < kNumPriors; ++prior) {
 
-    TH1F* prior_hist = nullptr;
-    TH1F* other_hist = nullptr;
+      const int bin = FindBin(static_cast<Prior>(prior), value);
+      const int other = prior == kElectron ? kPhoton : kElectron;
 
-    if (priorname == "electron") {
-      prior_hist = electronpriorHist;
-      other_hist = photonpriorHist;
-    }
-    if (priorname == "photon") {
-      prior_hist = photonpriorHist;
-      other_hist = electronpriorHist;
+      const float prob = fPriorTables[prior].prob[bin];
+      const float other_prob = fPriorTables[other].prob[bin];
+
+      if (prob == 0 && other_prob == 0) { continue; }
+
+      //Update the likelihoods and the mean probability
+      likelihood.logLikelihood[prior] += fPriorTables[prior].logProb[bin];
+      likelihood.logLikelihoodOther[prior] += fPriorTables[other].logProb[bin];
+      likelihood.probSum[prior] += prob;
     }
+  }
 
-    TAxis* xaxis = prior_hist->GetXaxis();
+  double ShowerBayesianTrucatingdEdx::CalculatePosterior(Prior prior,
+                                                         TrackLikelihood const& likelihood) const
+  {
+    //L/(L + L_other) written in terms of the log likelihoods so it does not underflow.
+    return 1. /
+           (1. + std::exp(likelihood.logLikelihoodOther[prior] - likelihood.logLikelihood[prior]));
+  }
+
+  double ShowerBayesianTrucatingdEdx::CalculatePosterior(Prior prior,
+                                                         std::vector<double> const& values,
+                                                         int& minprob_iter,
+                                                         float& mean,
+                                                         TrackLikelihood& likelihood) const
+  {
+    likelihood = TrackLikelihood();
+
+    //Minimum probability temp
+    float minprob_temp = 9999;
+    minprob_iter = 0;
 
     //Loop over the hits and calculate the probability
     for (int i = 0; i < (int)values.size(); ++i) {
 
       float value = values[i];
 
-      Int_t bin = xaxis->FindBin(value);
-
-      float prob = -9999;
-      float other_prob = -9999;
-
-      if (bin != xaxis->GetNbins() || bin == 0) {
-        //Calculate the likelihood
-        prob = prior_hist->GetBinContent(bin);
-        other_prob = other_hist->GetBinContent(bin);
-      }
-      else {
-        prob = 0;
-        other_prob = 0;
-      }
-
+      const float prob = fPriorTables[prior].prob[FindBin(prior, value)];
       if (prob < minprob_temp) {
         minprob_temp = prob;
         minprob_iter = i;
       }
 
-      if (prob == 0 && other_prob == 0) { continue; }
-
-      //Calculate the posterior the mean probability and liklihood
-      meanprob += prior_hist->GetBinContent(bin);
-      likelihood *= prob;
-      likelihood_other *= other_prob;
+      AddValue(likelihood, value);
     }
 
-    posterior = likelihood / (likelihood + likelihood_other);
-
-    meanprob /= values.size();
-    mean = meanprob;
-    return posterior;
+    mean = likelihood.probSum[prior] / values.size();
+    return CalculatePosterior(prior, likelihood);
   }
 
-  bool ShowerBayesianTrucatingdEdx::CheckPoint(std::string priorname, double& value)
+  bool ShowerBayesianTrucatingdEdx::CheckPoint(Prior prior, double value) const
   {
-
-    TH1F* prior_hist = nullptr;
-
-    if (priorname == "electron") { prior_hist = electronpriorHist; }
-    if (priorname == "photon") { prior_hist = photonpriorHist; }
-
-    TAxis* xaxis = prior_hist->GetXaxis();
-
-    Int_t bin = xaxis->FindBin(value);
-
-    float prob = -9999;
-
-    if (bin != xaxis->GetNbins() + 1 || bin == 0) {
-      //Calculate the likelihood
-      prob = prior_hist->GetBinContent(bin);
-    }
-    else {
-      prob = 0;
-    }
-
     //Return the probability of getting that point.
-    return prob > fProbPointCut;
+    return fPriorTables[prior].pointProb[FindBin(prior, value)] > fProbPointCut;
   }
 
   std::vector<double> ShowerBayesianTrucatingdEdx::GetLikelihooddEdxVec(
     double& electronprob,
     double& photonprob,
-    std::string prior,
-    std::vector<double>& dEdxVec)
+    Prior prior,
+    std::vector<double> const& dEdxVec) const
   {
 
-    //have a pool
-    std::vector<double> dEdxVec_temp = dEdxVec;
-
     //Get The seed track.
-    std::vector<double> SeedTrack = MakeSeed(dEdxVec_temp);
-    //    if(SeedTrack.size() < 1){
-    //  return SeedTrack;
-    // }
+    std::vector<double> SeedTrack = MakeSeed(dEdxVec);
 
     //Force the seed the be a good likelihood.
     float mean = 999;
     double posterior = 999;
-    ForceSeedToFit(SeedTrack, prior, mean, posterior);
+    TrackLikelihood likelihood;
+    ForceSeedToFit(SeedTrack, prior, mean, posterior, likelihood);
 
-    //Recursively add dEdx
-    int SkippedHitsNum = 0;
-    RecurivelyAddHit(SeedTrack, dEdxVec_temp, prior, SkippedHitsNum, mean, posterior);
+    //Add dEdx, the likelihood is updated as we go.
+    RecurivelyAddHit(SeedTrack, dEdxVec, prior, likelihood);
 
     //Calculate the likelihood of the vector  with the photon and electron priors.
-    electronprob = CalculatePosterior("electron", SeedTrack);
-    photonprob = CalculatePosterior("photon", SeedTrack);
+    electronprob = CalculatePosterior(kElectron, likelihood);
+    photonprob = CalculatePosterior(kPhoton, likelihood);
 
     return SeedTrack;
   }
 
-  std::vector<double> ShowerBayesianTrucatingdEdx::MakeSeed(std::vector<double>& dEdxVec)
+  std::vector<double> ShowerBayesianTrucatingdEdx::MakeSeed(
+    std::vector<double> const& dEdxVec) const
   {
-
-    std::vector<double> seed_vector;
-
     //Add the first hits to the seed
     int MaxHit = fNumSeedHits;
     if (fNumSeedHits > (int)dEdxVec.size()) { MaxHit = (int)dEdxVec.size(); }
 
-    //    if(MaxHit == 0){
-    //  mf::LogError("ShowerBayesianTrucatingdEdx") << "Size of the vector is 0 cannot perform the dEdx cutting "<< std::endl;
-    //}
-
-    for (int hit_iter = 0; hit_iter < MaxHit; ++hit_iter) {
-      seed_vector.push_back(dEdxVec[0]);
-      dEdxVec.erase(dEdxVec.begin());
-    }
-
-    return seed_vector;
+    return std::vector<double>(dEdxVec.begin(), dEdxVec.begin() + MaxHit);
   }
 
   void ShowerBayesianTrucatingdEdx::ForceSeedToFit(std::vector<double>& SeedTrack,
-                                                   std::string& prior,
+                                                   Prior prior,
                                                    float& mean,
-                                                   double& posterior)
+                                                   double& posterior,
+                                                   TrackLikelihood& likelihood) const
   {
 
     int minprob_iter = 999;
-    float likelihood = -999;
     float prob = CalculatePosterior(prior, SeedTrack, minprob_iter, mean, likelihood);
     while ((mean < fProbSeedCut || prob <= 0) && SeedTrack.size() > 1) {
 
       //Remove the the worse point.
-      // std::cout << "removing hit with dEdx: " << SeedTrack.at(minprob_iter) << std::endl;
       SeedTrack.erase(SeedTrack.begin() + minprob_iter);
       minprob_iter = 999;
 
@@ -409,55 +420,33 @@ namespace ShowerRecoTools {
       prob = CalculatePosterior(prior, SeedTrack, minprob_iter, mean, likelihood);
     }
     posterior = prob;
-    // std::cout << "seed has been fit with size: " << SeedTrack.size() << std::endl;
     return;
   }
 
   void ShowerBayesianTrucatingdEdx::RecurivelyAddHit(std::vector<double>& SeedTrack,
-                                                     std::vector<double>& dEdxVec,
-                                                     std::string& prior,
-                                                     int& SkippedHitsNum,
-                                                     float& old_mean,
-                                                     double& old_posteior)
+                                                     std::vector<double> const& dEdxVec,
+                                                     Prior prior,
+                                                     TrackLikelihood& likelihood) const
   {
 
-    //If we have no more hits to add then lets finish.
-    if (dEdxVec.size() < 1) { return; }
-
-    bool ok = CheckPoint(prior, dEdxVec[0]);
-    // int minprob_iter=999;
-    // float mean = -999;
-    // float likelihood =999;
-    // if(ok){std::cout << "passed first cut" << std::endl;}
-    // else{std::cout << "failed first cut" << std::endl;}
-    // double prob = CalculatePosterior(prior,SeedTrack,minprob_iter,mean,likelihood);
-    // ok *= isProbabilityGood(mean,old_mean);
-    // if(ok){std::cout << "passed second cut" << std::endl;}
-    // else{std::cout << "failed second cut" << std::endl;}
-    // ok *= isPosteriorProbabilityGood(prob,old_posteior);
-    // if(ok){std::cout << "passed this cut" << std::endl;}
-    // else{std::cout << "failed third cut" << std::endl;}
-
-    //If we failed lets try the next hits
-    if (!ok) {
-      // std::cout << "failed the pass point: " << dEdxVec[0] << " trying another hit" << SkippedHitsNum << std::endl;
-      //if(SeedTrack.size() > 1){SeedTrack.pop_back();}
-      ++SkippedHitsNum;
-      if (SkippedHitsNum > fnSkipHits) { return; }
-    }
-    else {
-      //Add the next point in question.
-      // std::cout << "adding value: " << dEdxVec[0] << std::endl;
-      //Reset the skip number
+    //The seed was taken from the front of the vector, carry on from there.
+    int SkippedHitsNum = 0;
+    for (auto dEdxIter = dEdxVec.begin() + std::min<std::size_t>(fNumSeedHits, dEdxVec.size());
+         dEdxIter != dEdxVec.end();
+         ++dEdxIter) {
+
+      //If we failed lets try the next hits
+      if (!CheckPoint(prior, *dEdxIter)) {
+        ++SkippedHitsNum;
+        if (SkippedHitsNum > fnSkipHits) { return; }
+        continue;
+      }
+
+      //Add the next point in question. Reset the skip number
       SkippedHitsNum = 0;
-      SeedTrack.push_back(dEdxVec[0]);
+      SeedTrack.push_back(*dEdxIter);
+      AddValue(likelihood, *dEdxIter);
     }
-
-    //We have analysed this hit now lets remove it.
-    dEdxVec.erase(dEdxVec.begin());
-
-    RecurivelyAddHit(SeedTrack, dEdxVec, prior, SkippedHitsNum, old_mean, old_posteior);
-
     return;
   }
 }
@@ -55,27 +55,23 @@ namespace ShowerRecoTools {
 
     bool IsSegmentValid(std::vector<art::Ptr<recob::SpacePoint>> const& segment);
 
-    bool IncrementallyFitSegment(const detinfo::DetectorClocksData& clockData,
-                                 const detinfo::DetectorPropertiesData& detProp,
+    bool IncrementallyFitSegment(const shower::ShowerChargeCorrections& corrections,
                                  std::vector<art::Ptr<recob::SpacePoint>>& segment,
                                  std::vector<art::Ptr<recob::SpacePoint>>& sps_pool,
                                  const art::FindManyP<recob::Hit>& fmh,
                                  double current_residual);
 
-    double FitSegmentAndCalculateResidual(const detinfo::DetectorClocksData& clockData,
-                                          const detinfo::DetectorPropertiesData& detProp,
+    double FitSegmentAndCalculateResidual(const shower::ShowerChargeCorrections& corrections,
                                           std::vector<art::Ptr<recob::SpacePoint>>& segment,
                                           const art::FindManyP<recob::Hit>& fmh);
 
-    double FitSegmentAndCalculateResidual(const detinfo::DetectorClocksData& clockData,
-                                          const detinfo::DetectorPropertiesData& detProp,
+    double FitSegmentAndCalculateResidual(const shower::ShowerChargeCorrections& corrections,
                                           std::vector<art::Ptr<recob::SpacePoint>>& segment,
                                           const art::FindManyP<recob::Hit>& fmh,
                                           int& max_residual_point);
 
     bool RecursivelyReplaceLastSpacePointAndRefit(
-      const detinfo::DetectorClocksData& clockData,
-      const detinfo::DetectorPropertiesData& detProp,
+      const shower::ShowerChargeCorrections& corrections,
       std::vector<art::Ptr<recob::SpacePoint>>& segment,
       std::vector<art::Ptr<recob::SpacePoint>>& reduced_sps_pool,
       const art::FindManyP<recob::Hit>& fmh,
@@ -106,8 +102,7 @@ namespace ShowerRecoTools {
     //Function to calculate the shower direction using a charge weight 3D PCA calculation.
     geo::Vector_t ShowerPCAVector(std::vector<art::Ptr<recob::SpacePoint>> const& sps) const;
 
-    geo::Vector_t ShowerPCAVector(const detinfo::DetectorClocksData& clockData,
-                                  const detinfo::DetectorPropertiesData& detProp,
+    geo::Vector_t ShowerPCAVector(const shower::ShowerChargeCorrections& corrections,
                                   const std::vector<art::Ptr<recob::SpacePoint>>& sps,
                                   const art::FindManyP<recob::Hit>& fmh) const;
 
@@ -120,8 +115,7 @@ namespace ShowerRecoTools {
     void RunTestOfIncrementalSpacePointFinder(const art::Event& Event,
                                               const art::FindManyP<recob::Hit>& dud_fmh);
 
-    void MakeTrackSeed(const detinfo::DetectorClocksData& clockData,
-                       const detinfo::DetectorPropertiesData& detProp,
+    void MakeTrackSeed(const shower::ShowerChargeCorrections& corrections,
                        std::vector<art::Ptr<recob::SpacePoint>>& segment,
                        const art::FindManyP<recob::Hit>& fmh);
 
@@ -325,8 +319,7 @@ namespace ShowerRecoTools {
 
   //Function to calculate the shower direction using a charge weight 3D PCA calculation.
   geo::Vector_t ShowerIncrementalTrackHitFinder::ShowerPCAVector(
-    const detinfo::DetectorClocksData& clockData,
-    const detinfo::DetectorPropertiesData& detProp,
+    const shower::ShowerChargeCorrections& corrections,
     const std::vector<art::Ptr<recob::SpacePoint>>& sps,
     const art::FindManyP<recob::Hit>& fmh) const
   {
@@ -341,11 +334,9 @@ namespace ShowerRecoTools {
       float wht = 1;
 
       if (fChargeWeighted) {
-        float Charge = IShowerTool::GetLArPandoraShowerAlg().SpacePointCharge(sp, fmh);
-        float Time = IShowerTool::GetLArPandoraShowerAlg().SpacePointTime(sp, fmh);
-
         //Correct for the lifetime at the moment.
-        Charge *= std::exp((sampling_rate(clockData) * Time) / (detProp.ElectronLifetime() * 1e3));
+        float Charge =
+          IShowerTool::GetLArPandoraShowerAlg().SpacePointCorrectedCharge(sp, fmh, corrections);
 
         //Charge Weight
         wht *= std::sqrt(Charge / TotalCharge);
@@ -367,8 +358,7 @@ namespace ShowerRecoTools {
   //Function to remove the spacepoint with the highest residual until we have a track which matches the
   //residual criteria.
   void ShowerIncrementalTrackHitFinder::MakeTrackSeed(
-    const detinfo::DetectorClocksData& clockData,
-    const detinfo::DetectorPropertiesData& detProp,
+    const shower::ShowerChargeCorrections& corrections,
     std::vector<art::Ptr<recob::SpacePoint>>& segment,
     const art::FindManyP<recob::Hit>& fmh)
   {
@@ -378,8 +368,7 @@ namespace ShowerRecoTools {
     int maxresidual_point = 0;
 
     //Check the residual
-    double residual =
-      FitSegmentAndCalculateResidual(clockData, detProp, segment, fmh, maxresidual_point);
+    double residual = FitSegmentAndCalculateResidual(corrections, segment, fmh, maxresidual_point);
 
     //Is it okay
     ok = IsResidualOK(residual, segment.size());
@@ -397,7 +386,7 @@ namespace ShowerRecoTools {
 
       //Check the residual
       double residual =
-        FitSegmentAndCalculateResidual(clockData, detProp, segment, fmh, maxresidual_point);
+        FitSegmentAndCalculateResidual(corrections, segment, fmh, maxresidual_point);
 
       //Is it okay
       ok = IsResidualOK(residual, segment.size());
@@ -416,6 +405,9 @@ namespace ShowerRecoTools {
     auto const detProp =
       art::ServiceHandle<detinfo::DetectorPropertiesService const>()->DataFor(Event, clockData);
 
+    //The same space points are charge weighted many times while fitting so tabulate the corrections
+    const shower::ShowerChargeCorrections corrections(clockData, detProp);
+
     //Create space point pool (yes we are copying the input vector because we're going to twiddle with it
     std::vector<art::Ptr<recob::SpacePoint>> sps_pool = sps;
     std::vector<art::Ptr<recob::SpacePoint>> initial_track;
@@ -434,7 +426,7 @@ namespace ShowerRecoTools {
 
       //Lets really try to make the initial track seed.
       if (fMakeTrackSeed && sps_pool.size() + fStartFitSize == sps.size()) {
-        MakeTrackSeed(clockData, detProp, track_segment, fmh);
+        MakeTrackSeed(corrections, track_segment, fmh);
         if (track_segment.empty()) break;
 
         track_segment_copy = track_segment;
@@ -449,7 +441,7 @@ namespace ShowerRecoTools {
       double current_residual = 0;
       size_t initial_segment_size = track_segment.size();
 
-      IncrementallyFitSegment(clockData, detProp, track_segment, sps_pool, fmh, current_residual);
+      IncrementallyFitSegment(corrections, track_segment, sps_pool, fmh, current_residual);
 
       //Check if the track has grown in size at all
       if (initial_segment_size == track_segment.size()) {
@@ -532,8 +524,7 @@ namespace ShowerRecoTools {
   }
 
   bool ShowerIncrementalTrackHitFinder::IncrementallyFitSegment(
-    const detinfo::DetectorClocksData& clockData,
-    const detinfo::DetectorPropertiesData& detProp,
+    const shower::ShowerChargeCorrections& corrections,
     std::vector<art::Ptr<recob::SpacePoint>>& segment,
     std::vector<art::Ptr<recob::SpacePoint>>& sps_pool,
     const art::FindManyP<recob::Hit>& fmh,
@@ -544,11 +535,11 @@ namespace ShowerRecoTools {
     //Firstly, are there any space points left???
     if (sps_pool.empty()) return !ok;
     //Fit the current line
-    current_residual = FitSegmentAndCalculateResidual(clockData, detProp, segment, fmh);
+    current_residual = FitSegmentAndCalculateResidual(corrections, segment, fmh);
     //Take a space point from the pool and plonk it onto the seggieweggie
     AddSpacePointsToSegment(segment, sps_pool, 1);
     //Fit again
-    double residual = FitSegmentAndCalculateResidual(clockData, detProp, segment, fmh);
+    double residual = FitSegmentAndCalculateResidual(corrections, segment, fmh);
 
     ok = IsResidualOK(residual, current_residual, segment.size());
     if (!ok) {
@@ -563,7 +554,7 @@ namespace ShowerRecoTools {
       //add the bad SP to the front of the cache
       sub_sps_pool_cache.insert(sub_sps_pool_cache.begin(), segment.back());
       ok = RecursivelyReplaceLastSpacePointAndRefit(
-        clockData, detProp, segment, sub_sps_pool, fmh, current_residual);
+        corrections, segment, sub_sps_pool, fmh, current_residual);
       if (ok) {
         //The refitting may have dropped a couple of points but it managed to find a point that kept the residual
         //at a sensible value.
@@ -573,7 +564,7 @@ namespace ShowerRecoTools {
           sub_sps_pool.pop_back();
         }
         //We'll need the latest residual now that we've managed to refit the track
-        residual = FitSegmentAndCalculateResidual(clockData, detProp, segment, fmh);
+        residual = FitSegmentAndCalculateResidual(corrections, segment, fmh);
       }
       else {
         //All of the space points in the reduced pool could not sensibly refit the track.  The reduced pool will be
@@ -594,25 +585,24 @@ namespace ShowerRecoTools {
 
     //Round and round we go
     //NOBODY GETS OFF MR BONES WILD RIDE
-    return IncrementallyFitSegment(clockData, detProp, segment, sps_pool, fmh, current_residual);
+    return IncrementallyFitSegment(corrections, segment, sps_pool, fmh, current_residual);
   }
 
   double ShowerIncrementalTrackHitFinder::FitSegmentAndCalculateResidual(
-    const detinfo::DetectorClocksData& clockData,
-    const detinfo::DetectorPropertiesData& detProp,
+    const shower::ShowerChargeCorrections& corrections,
     std::vector<art::Ptr<recob::SpacePoint>>& segment,
     const art::FindManyP<recob::Hit>& fmh)
   {
     geo::Vector_t primary_axis;
     if (fChargeWeighted)
-      primary_axis = ShowerPCAVector(clockData, detProp, segment, fmh);
+      primary_axis = ShowerPCAVector(corrections, segment, fmh);
     else
       primary_axis = ShowerPCAVector(segment);
 
     geo::Point_t segment_centre;
     if (fChargeWeighted)
       segment_centre =
-        IShowerTool::GetLArPandoraShowerAlg().ShowerCentre(clockData, detProp, segment, fmh);
+        IShowerTool::GetLArPandoraShowerAlg().ShowerCentre(corrections, segment, fmh);
     else
       segment_centre = IShowerTool::GetLArPandoraShowerAlg().ShowerCentre(segment);
 
@@ -620,22 +610,21 @@ namespace ShowerRecoTools {
   }
 
   double ShowerIncrementalTrackHitFinder::FitSegmentAndCalculateResidual(
-    const detinfo::DetectorClocksData& clockData,
-    const detinfo::DetectorPropertiesData& detProp,
+    const shower::ShowerChargeCorrections& corrections,
     std::vector<art::Ptr<recob::SpacePoint>>& segment,
     const art::FindManyP<recob::Hit>& fmh,
     int& max_residual_point)
   {
     geo::Vector_t primary_axis;
     if (fChargeWeighted)
-      primary_axis = ShowerPCAVector(clockData, detProp, segment, fmh);
+      primary_axis = ShowerPCAVector(corrections, segment, fmh);
     else
       primary_axis = ShowerPCAVector(segment);
 
     geo::Point_t segment_centre;
     if (fChargeWeighted)
       segment_centre =
-        IShowerTool::GetLArPandoraShowerAlg().ShowerCentre(clockData, detProp, segment, fmh);
+        IShowerTool::GetLArPandoraShowerAlg().ShowerCentre(corrections, segment, fmh);
     else
       segment_centre = IShowerTool::GetLArPandoraShowerAlg().ShowerCentre(segment);
 
@@ -643,8 +632,7 @@ namespace ShowerRecoTools {
   }
 
   bool ShowerIncrementalTrackHitFinder::RecursivelyReplaceLastSpacePointAndRefit(
-    const detinfo::DetectorClocksData& clockData,
-    const detinfo::DetectorPropertiesData& detProp,
+    const shower::ShowerChargeCorrections& corrections,
     std::vector<art::Ptr<recob::SpacePoint>>& segment,
     std::vector<art::Ptr<recob::SpacePoint>>& reduced_sps_pool,
     const art::FindManyP<recob::Hit>& fmh,
@@ -658,13 +646,13 @@ namespace ShowerRecoTools {
     segment.pop_back();
     //Add one point
     AddSpacePointsToSegment(segment, reduced_sps_pool, 1);
-    double residual = FitSegmentAndCalculateResidual(clockData, detProp, segment, fmh);
+    double residual = FitSegmentAndCalculateResidual(corrections, segment, fmh);
 
     ok = IsResidualOK(residual, current_residual, segment.size());
     //    std::cout<<"recursive refit: isok " << ok << "  res: " << residual << "  curr res: " << current_residual << std::endl;
     if (ok) return ok;
     return RecursivelyReplaceLastSpacePointAndRefit(
-      clockData, detProp, segment, reduced_sps_pool, fmh, current_residual);
+      corrections, segment, reduced_sps_pool, fmh, current_residual);
   }
 
   double ShowerIncrementalTrackHitFinder::CalculateResidual(
@@ -19,6 +19,7 @@
 #include "lardataobj/RecoBase/PFParticle.h"
 #include "lardataobj/RecoBase/SpacePoint.h"
 #include "lardataobj/RecoBase/Track.h"
+#include "larpandora/LArPandoraEventBuilding/LArPandoraShower/Algs/ShowerSpatialIndex.h"
 #include "larpandora/LArPandoraEventBuilding/LArPandoraShower/Tools/IShowerTool.h"
 #include "larreco/Calorimetry/CalorimetryAlg.h"
 
@@ -192,6 +193,28 @@ namespace ShowerRecoTools {
     auto const detProp =
       art::ServiceHandle<detinfo::DetectorPropertiesService const>()->DataFor(Event, clockData);
 
+    //Index the usable trajectory points so each spacepoint only looks at its neighbourhood.
+    std::vector<geo::Point_t> trajPositions;
+    std::vector<unsigned int> trajIndices;
+    for (unsigned int traj = 0; traj < InitialTrack.NumberTrajectoryPoints(); ++traj) {
+
+      //ignore bogus info.
+      auto flags = InitialTrack.FlagsAtPoint(traj);
+      if (flags.isSet(recob::TrajectoryPointFlagTraits::NoPoint)) { continue; }
+
+      trajPositions.push_back(InitialTrack.LocationAtPoint(traj));
+      trajIndices.push_back(traj);
+    }
+
+    //Only hits in the vertex TPC are used so size the voxels for the largest search there.
+    double maxWirePitch = 0;
+    if (vtxTPC.isValid) {
+      for (unsigned int plane = 0; plane < fGeom->Nplanes(vtxTPC); ++plane) {
+        maxWirePitch = std::max(maxWirePitch, fGeom->WirePitch(geo::PlaneID(vtxTPC, plane)));
+      }
+    }
+    const shower::ShowerSpatialIndex trajIndex(trajPositions, MaxDist * maxWirePitch);
+
     std::map<art::Ptr<recob::Hit>, std::vector<art::Ptr<recob::Hit>>> hitSnippets;
     if (fSumHitSnippets) {
       std::vector<art::Ptr<recob::Hit>> trackHits;
@@ -233,26 +256,11 @@ namespace ShowerRecoTools {
       }
 
       //Find the closest trajectory point of the track. These should be in order if the user has used ShowerTrackTrajToSpacePoint_tool but the sake of gernicness I'll get the cloest sp.
-      unsigned int index = 999;
-      double MinDist = 999;
-      for (unsigned int traj = 0; traj < InitialTrack.NumberTrajectoryPoints(); ++traj) {
-
-        //ignore bogus info.
-        auto flags = InitialTrack.FlagsAtPoint(traj);
-        if (flags.isSet(recob::TrajectoryPointFlagTraits::NoPoint)) { continue; }
-
-        geo::Point_t const TrajPosition = InitialTrack.LocationAtPoint(traj);
-
-        auto const dist = (pos - TrajPosition).R();
-
-        if (dist < MinDist && dist < MaxDist * wirepitch) {
-          MinDist = dist;
-          index = traj;
-        }
-      }
+      const std::size_t nearest = trajIndex.NearestPoint(pos, std::min(999., MaxDist * wirepitch));
 
       //If there is no matching trajectory point then bail.
-      if (index == 999) { continue; }
+      if (nearest == trajIndex.NPoints()) { continue; }
+      const unsigned int index = trajIndices[nearest];
 
       geo::Point_t const TrajPosition = InitialTrack.LocationAtPoint(index);
       geo::Point_t const TrajPositionStart = InitialTrack.LocationAtPoint(0);
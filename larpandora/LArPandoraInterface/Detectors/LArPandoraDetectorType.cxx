@@ -9,10 +9,103 @@
 #include "larpandora/LArPandoraInterface/Detectors/LArPandoraDetectorType.h"
 #include "larpandora/LArPandoraInterface/LArPandoraGeometryComponents.h"
 
+#include "Managers/PluginManager.h"
+#include "Pandora/Pandora.h"
+#include "Plugins/LArTransformationPlugin.h"
+
+#include <algorithm>
+#include <array>
 #include <limits>
+#include <map>
+#include <tuple>
 
 namespace lar_pandora {
 
+  float LArPandoraDetectorType::MaxDetectorGapX(const float) const
+  {
+    return std::numeric_limits<float>::max();
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  void LArPandoraDetectorType::TransformWirePositions(const std::vector<geo::WireID>& wireIDs,
+                                                      const std::vector<geo::View_t>& views,
+                                                      const std::vector<double>& wireYs,
+                                                      const std::vector<double>& wireZs,
+                                                      const pandora::Pandora* pPandora,
+                                                      std::vector<pandora::HitType>& hitTypes,
+                                                      std::vector<double>& wirePositions,
+                                                      std::vector<bool>& isTransformed) const
+  {
+    const std::size_t nHits(wireIDs.size());
+
+    if ((views.size() != nHits) || (wireYs.size() != nHits) || (wireZs.size() != nHits))
+      throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
+
+    hitTypes.assign(nHits, pandora::HIT_CUSTOM);
+    wirePositions.assign(nHits, 0.);
+    isTransformed.assign(nHits, true);
+
+    // Map the LArSoft views of each TPC to Pandora views once, testing W, then U, then V, as for a single hit
+    typedef std::array<geo::View_t, 3> TargetViews;
+    std::map<geo::TPCID, TargetViews> tpcToTargetViews;
+    const std::array<pandora::HitType, 3> targetHitTypes{
+      {pandora::TPC_VIEW_W, pandora::TPC_VIEW_U, pandora::TPC_VIEW_V}};
+
+    for (std::size_t iHit = 0; iHit < nHits; ++iHit) {
+      const geo::TPCID& tpcID(wireIDs[iHit].asTPCID());
+      std::map<geo::TPCID, TargetViews>::const_iterator iter(tpcToTargetViews.find(tpcID));
+
+      if (tpcToTargetViews.end() == iter) {
+        try {
+          const TargetViews targetViews{{this->TargetViewW(tpcID.TPC, tpcID.Cryostat),
+                                         this->TargetViewU(tpcID.TPC, tpcID.Cryostat),
+                                         this->TargetViewV(tpcID.TPC, tpcID.Cryostat)}};
+          iter = tpcToTargetViews.emplace(tpcID, targetViews).first;
+        }
+        catch (const pandora::StatusCodeException&) {
+          isTransformed[iHit] = false;
+          continue;
+        }
+      }
+
+      for (unsigned int iView = 0; iView < targetHitTypes.size(); ++iView) {
+        if (views[iHit] == iter->second[iView]) {
+          hitTypes[iHit] = targetHitTypes[iView];
+          break;
+        }
+      }
+    }
+
+    // Transform the wire positions, with the transformation plugin held for the whole batch
+    const pandora::LArTransformationPlugin* const pTransformationPlugin(
+      pPandora->GetPlugins()->GetLArTransformationPlugin());
+
+    for (std::size_t iHit = 0; iHit < nHits; ++iHit) {
+      if (!isTransformed[iHit]) continue;
+
+      try {
+        switch (hitTypes[iHit]) {
+        case pandora::TPC_VIEW_U:
+          wirePositions[iHit] = pTransformationPlugin->YZtoU(wireYs[iHit], wireZs[iHit]);
+          break;
+        case pandora::TPC_VIEW_V:
+          wirePositions[iHit] = pTransformationPlugin->YZtoV(wireYs[iHit], wireZs[iHit]);
+          break;
+        case pandora::TPC_VIEW_W:
+          wirePositions[iHit] = pTransformationPlugin->YZtoW(wireYs[iHit], wireZs[iHit]);
+          break;
+        default: break;
+        }
+      }
+      catch (const pandora::StatusCodeException&) {
+        isTransformed[iHit] = false;
+      }
+    }
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
   float detector_functions::WireAngle(const geo::View_t view,
                                       const geo::TPCID::TPCID_t tpc,
                                       const geo::CryostatID::CryostatID_t cstat,
@@ -56,4 +149,89 @@ namespace lar_pandora {
     return parameters;
   }
 
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  void detector_functions::CoalesceLineGaps(LineGapParametersList& parametersList)
+  {
+    // ATTN Merging along one coordinate can create new merges along the other, so alternate until neither changes
+    bool isChanged(true);
+    while (isChanged) {
+      const bool isChangedAlongZ(detector_functions::CoalesceLineGapsOnce(parametersList, true));
+      const bool isChangedAlongX(detector_functions::CoalesceLineGapsOnce(parametersList, false));
+      isChanged = (isChangedAlongZ || isChangedAlongX);
+    }
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  bool detector_functions::CoalesceLineGapsOnce(LineGapParametersList& parametersList,
+                                                const bool alongZ)
+  {
+    typedef PandoraApi::Geometry::LineGap::Parameters Parameters;
+
+    // The shared (fixed) and merged (free) ranges of a gap, for the chosen coordinate
+    auto fixedStart = [alongZ](const Parameters& gap) -> float {
+      return (alongZ ? gap.m_lineStartX.Get() : gap.m_lineStartZ.Get());
+    };
+    auto fixedEnd = [alongZ](const Parameters& gap) -> float {
+      return (alongZ ? gap.m_lineEndX.Get() : gap.m_lineEndZ.Get());
+    };
+    auto freeStart = [alongZ](const Parameters& gap) -> float {
+      return (alongZ ? gap.m_lineStartZ.Get() : gap.m_lineStartX.Get());
+    };
+    auto freeEnd = [alongZ](const Parameters& gap) -> float {
+      return (alongZ ? gap.m_lineEndZ.Get() : gap.m_lineEndX.Get());
+    };
+
+    // Gaps with reversed ranges are passed through untouched
+    LineGapParametersList candidates, reversedGaps;
+    for (const Parameters& gap : parametersList) {
+      if ((gap.m_lineStartX.Get() <= gap.m_lineEndX.Get()) &&
+          (gap.m_lineStartZ.Get() <= gap.m_lineEndZ.Get()))
+        candidates.push_back(gap);
+      else
+        reversedGaps.push_back(gap);
+    }
+
+    auto sortKey = [&](const Parameters& gap) {
+      return std::make_tuple(
+        gap.m_lineGapType.Get(), fixedStart(gap), fixedEnd(gap), freeStart(gap));
+    };
+    std::stable_sort(candidates.begin(),
+                     candidates.end(),
+                     [&sortKey](const Parameters& lhs, const Parameters& rhs) {
+                       return (sortKey(lhs) < sortKey(rhs));
+                     });
+
+    bool isChanged(false);
+    LineGapParametersList coalescedList;
+
+    for (const Parameters& gap : candidates) {
+      if (!coalescedList.empty()) {
+        Parameters& previous(coalescedList.back());
+
+        if ((previous.m_lineGapType.Get() == gap.m_lineGapType.Get()) &&
+            (fixedStart(previous) == fixedStart(gap)) && (fixedEnd(previous) == fixedEnd(gap)) &&
+            (freeStart(gap) <= freeEnd(previous))) {
+          const float mergedEnd(std::max(freeEnd(previous), freeEnd(gap)));
+
+          if (alongZ)
+            previous.m_lineEndZ = mergedEnd;
+          else
+            previous.m_lineEndX = mergedEnd;
+
+          isChanged = true;
+          continue;
+        }
+      }
+
+      coalescedList.push_back(gap);
+    }
+
+    coalescedList.insert(coalescedList.end(), reversedGaps.begin(), reversedGaps.end());
+    parametersList = coalescedList;
+
+    return isChanged;
+  }
+
 } // namespace lar_pandora
@@ -17,11 +17,14 @@
 
 #include "Api/PandoraApi.h"
 
+#include <vector>
+
 namespace lar_pandora {
 
   class LArDriftVolume;
   class LArDetectorGap;
   typedef std::vector<LArDetectorGap> LArDetectorGapList;
+  typedef std::vector<PandoraApi::Geometry::LineGap::Parameters> LineGapParametersList;
 
   /**
      *  @brief  Empty interface to map pandora to specifics in the LArSoft geometry
@@ -115,6 +118,15 @@ namespace lar_pandora {
                                       const geo::Vector_t& deltas,
                                       const float maxDisplacement) const = 0;
 
+    /**
+             *  @brief  The largest gap in X that CheckDetectorGapSize can accept, so that volume
+             *          pairs further apart need not be checked (unbounded by default)
+             *
+             *  @param  maxDisplacement the gap size threshold
+             *  @result the maximum gap in X
+             */
+    virtual float MaxDetectorGapX(const float maxDisplacement) const;
+
     /**
              *  @brief  Create a detector gap
              *
@@ -171,6 +183,29 @@ namespace lar_pandora {
       const float xFirst,
       const float xLast,
       const pandora::Pandora* pPandora) const = 0;
+
+    /**
+             *  @brief  Map a batch of hits to Pandora views and transform their wire positions into Pandora
+             *          U/V/W coordinates. The view mapping is evaluated once per TPC, rather than per hit
+             *
+             *  @param  wireIDs the LArSoft wire IDs
+             *  @param  views the LArSoft views
+             *  @param  wireYs the Y coordinates of the wire centres
+             *  @param  wireZs the Z coordinates of the wire centres
+             *  @param  pPandora the pandora instance
+             *  @param  hitTypes to receive the Pandora views, pandora::HIT_CUSTOM if a view is not recognised
+             *  @param  wirePositions to receive the Pandora U/V/W coordinates
+             *  @param  isTransformed to receive whether each hit was transformed, false if a Pandora status code exception
+             *          was thrown for it, so that a single bad hit can be skipped rather than failing the batch
+             */
+    virtual void TransformWirePositions(const std::vector<geo::WireID>& wireIDs,
+                                        const std::vector<geo::View_t>& views,
+                                        const std::vector<double>& wireYs,
+                                        const std::vector<double>& wireZs,
+                                        const pandora::Pandora* pPandora,
+                                        std::vector<pandora::HitType>& hitTypes,
+                                        std::vector<double>& wirePositions,
+                                        std::vector<bool>& isTransformed) const;
   };
 
   namespace detector_functions {
@@ -216,6 +251,24 @@ namespace lar_pandora {
       const float halfWirePitch,
       const pandora::LineGapType gapType);
 
+    /**
+         *  @brief  Coalesce line gaps of the same type whose union is itself a line gap, i.e. gaps with
+         *          the same X range and overlapping or touching Z ranges, or vice versa
+         *
+         *  @param  parametersList the line gap parameters, to be replaced by the coalesced list
+         */
+    void CoalesceLineGaps(LineGapParametersList& parametersList);
+
+    /**
+         *  @brief  Coalesce, in one pass, line gaps sharing a range in one coordinate whose ranges in
+         *          the other coordinate overlap or touch
+         *
+         *  @param  parametersList the line gap parameters, to be replaced by the coalesced list
+         *  @param  alongZ whether to coalesce along Z (gaps sharing an X range) or along X
+         *  @return whether any gaps were coalesced
+         */
+    bool CoalesceLineGapsOnce(LineGapParametersList& parametersList, const bool alongZ);
+
   } // namespace detector_functions
 
 } // namespace lar_pandora
@@ -37,6 +37,8 @@ namespace lar_pandora {
                               const geo::Vector_t& deltas,
                               const float maxDisplacement) const override;
 
+    float MaxDetectorGapX(const float maxDisplacement) const override;
+
     LArDetectorGap CreateDetectorGap(const geo::Point_t& point1,
                                      const geo::Point_t& point2,
                                      const geo::Vector_t& widths) const override;
@@ -113,6 +115,14 @@ namespace lar_pandora {
 
   //------------------------------------------------------------------------------------------------------------------------------------------
 
+  inline float ProtoDUNEDualPhase::MaxDetectorGapX(const float) const
+  {
+    // ATTN Gaps are accepted on their Y and Z sizes alone, so any separation in X is possible
+    return std::numeric_limits<float>::max();
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
   inline LArDetectorGap ProtoDUNEDualPhase::CreateDetectorGap(const geo::Point_t& point1,
                                                               const geo::Point_t& point2,
                                                               const geo::Vector_t& widths) const
@@ -55,6 +55,8 @@ namespace lar_pandora {
                                       const geo::Vector_t& deltas,
                                       const float maxDisplacement) const override;
 
+    virtual float MaxDetectorGapX(const float maxDisplacement) const override;
+
     virtual LArDetectorGap CreateDetectorGap(const geo::Point_t& point1,
                                              const geo::Point_t& point2,
                                              const geo::Vector_t& widths) const override;
@@ -181,6 +183,13 @@ namespace lar_pandora {
 
   //------------------------------------------------------------------------------------------------------------------------------------------
 
+  inline float VintageLArTPCThreeView::MaxDetectorGapX(const float maxDisplacement) const
+  {
+    return maxDisplacement;
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
   inline LArDetectorGap VintageLArTPCThreeView::CreateDetectorGap(const geo::Point_t& point1,
                                                                   const geo::Point_t& point2,
                                                                   const geo::Vector_t& widths) const
@@ -30,12 +30,22 @@
 #include "nusimdata/SimulationBase/MCParticle.h"
 
 #include "Api/PandoraApi.h"
+#include "Objects/Cluster.h"
+#include "Objects/MCParticle.h"
+#include "Objects/ParticleFlowObject.h"
 
 #include "larpandoracontent/LArContent.h"
+#include "larpandoracontent/LArControlFlow/MultiPandoraApi.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
+#include "larpandoracontent/LArObjects/LArCaloHit.h"
+#include "larpandoracontent/LArObjects/LArMCParticle.h"
 
+#include "TTree.h"
+
+#include <algorithm>
 #include <iostream>
 #include <limits>
+#include <vector>
 
 namespace lar_pandora {
 
@@ -64,6 +74,16 @@ namespace lar_pandora {
     , m_lineGapsCreated(false)
     , m_collectHitsTool{
         art::make_tool<IHitCollectionTool>(this->ConstructHitCollectionToolParameterSet(pset))}
+    , m_enableMemoryAccounting(pset.get<bool>("EnableMemoryAccounting", false))
+    , m_writeMemoryTree(pset.get<bool>("WriteMemoryTree", false))
+    , m_driftVolumeBytes(0)
+    , m_driftVolumeMapBytes(0)
+    , m_detectorGapBytes(0)
+    , m_nAccountedEvents(0)
+    , m_pMemoryTree(nullptr)
+    , m_run(0)
+    , m_subrun(0)
+    , m_event(0)
   {
     m_inputSettings.m_useHitWidths = pset.get<bool>("UseHitWidths", true);
     m_inputSettings.m_useBirksCorrection = pset.get<bool>("UseBirksCorrection", false);
@@ -149,14 +169,44 @@ namespace lar_pandora {
     LArPandoraInput::CreatePandoraLArTPCs(m_inputSettings, driftVolumeList);
 
     // If using global drift volume approach, pass details of gaps between daughter volumes to the pandora instance
+    LArDetectorGapList listOfGaps;
     if (m_enableDetectorGaps) {
-      LArDetectorGapList listOfGaps;
       LArPandoraGeometry::LoadDetectorGaps(listOfGaps, m_inputSettings.m_useActiveBoundingBox);
       LArPandoraInput::CreatePandoraDetectorGaps(m_inputSettings, driftVolumeList, listOfGaps);
     }
 
     // Parse Pandora settings xml files
     this->ConfigurePandoraInstances();
+
+    if (m_enableMemoryAccounting) {
+      m_driftVolumeBytes =
+        LArPandoraGeometry::GetMemoryUsage(m_driftVolumeMap.GetDriftVolumeList());
+      m_driftVolumeMapBytes = LArPandoraGeometry::GetMemoryUsage(m_driftVolumeMap);
+      m_detectorGapBytes = LArPandoraGeometry::GetMemoryUsage(listOfGaps);
+
+      if (m_writeMemoryTree) {
+        art::ServiceHandle<art::TFileService const> tfs;
+        m_pMemoryTree = tfs->make<TTree>(
+          "pandoraMemory", "LArPandora per-event memory usage, current lists and shallow sizes");
+        m_pMemoryTree->Branch("run", &m_run, "run/I");
+        m_pMemoryTree->Branch("subrun", &m_subrun, "subrun/I");
+        m_pMemoryTree->Branch("event", &m_event, "event/I");
+        m_pMemoryTree->Branch("nCaloHits", &m_eventMemoryUsage.m_nCaloHits, "nCaloHits/I");
+        m_pMemoryTree->Branch(
+          "caloHitShallowBytes", &m_eventMemoryUsage.m_caloHitBytes, "caloHitShallowBytes/L");
+        m_pMemoryTree->Branch(
+          "nMCParticles", &m_eventMemoryUsage.m_nMCParticles, "nMCParticles/I");
+        m_pMemoryTree->Branch("mcParticleShallowBytes",
+                              &m_eventMemoryUsage.m_mcParticleBytes,
+                              "mcParticleShallowBytes/L");
+        m_pMemoryTree->Branch("nClusters", &m_eventMemoryUsage.m_nClusters, "nClusters/I");
+        m_pMemoryTree->Branch(
+          "clusterShallowBytes", &m_eventMemoryUsage.m_clusterBytes, "clusterShallowBytes/L");
+        m_pMemoryTree->Branch("nPfos", &m_eventMemoryUsage.m_nPfos, "nPfos/I");
+        m_pMemoryTree->Branch(
+          "pfoShallowBytes", &m_eventMemoryUsage.m_pfoBytes, "pfoShallowBytes/L");
+      }
+    }
   }
 
   //------------------------------------------------------------------------------------------------------------------------------------------
@@ -166,12 +216,43 @@ namespace lar_pandora {
     IdToHitMap idToHitMap;
     this->CreatePandoraInput(evt, idToHitMap);
     this->RunPandoraInstances();
+
+    if (m_enableMemoryAccounting) this->AccountMemoryUsage(evt);
+
     this->ProcessPandoraOutput(evt, idToHitMap);
     this->ResetPandoraInstances();
   }
 
   //------------------------------------------------------------------------------------------------------------------------------------------
 
+  void LArPandora::endJob()
+  {
+    if (!m_enableMemoryAccounting) return;
+
+    const double nEvents(std::max(1u, m_nAccountedEvents));
+
+    mf::LogInfo("LArPandora")
+      << " LArPandora::endJob - estimated memory usage (bytes, shallow)" << std::endl
+      << "   geometry: drift volumes " << m_driftVolumeBytes << ", drift volume map "
+      << m_driftVolumeMapBytes << ", detector gaps " << m_detectorGapBytes << std::endl
+      << "   per event, current lists of all instances, mean (max) over " << m_nAccountedEvents
+      << " events:" << std::endl
+      << "   calo hits " << m_totalMemoryUsage.m_nCaloHits / nEvents << " ("
+      << m_maxMemoryUsage.m_nCaloHits << "), " << m_totalMemoryUsage.m_caloHitBytes / nEvents
+      << " (" << m_maxMemoryUsage.m_caloHitBytes << ") bytes" << std::endl
+      << "   mc particles " << m_totalMemoryUsage.m_nMCParticles / nEvents << " ("
+      << m_maxMemoryUsage.m_nMCParticles << "), " << m_totalMemoryUsage.m_mcParticleBytes / nEvents
+      << " (" << m_maxMemoryUsage.m_mcParticleBytes << ") bytes" << std::endl
+      << "   clusters " << m_totalMemoryUsage.m_nClusters / nEvents << " ("
+      << m_maxMemoryUsage.m_nClusters << "), " << m_totalMemoryUsage.m_clusterBytes / nEvents
+      << " (" << m_maxMemoryUsage.m_clusterBytes << ") bytes" << std::endl
+      << "   pfos " << m_totalMemoryUsage.m_nPfos / nEvents << " (" << m_maxMemoryUsage.m_nPfos
+      << "), " << m_totalMemoryUsage.m_pfoBytes / nEvents << " ("
+      << m_maxMemoryUsage.m_pfoBytes << ") bytes" << std::endl;
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
   void LArPandora::CreatePandoraInput(art::Event& evt, IdToHitMap& idToHitMap)
   {
     // ATTN Should complete gap creation in begin job callback, but channel status service functionality unavailable at that point
@@ -253,6 +334,94 @@ namespace lar_pandora {
 
   //------------------------------------------------------------------------------------------------------------------------------------------
 
+  void LArPandora::AccountMemoryUsage(const art::Event& evt)
+  {
+    // ATTN Counts are taken from the current lists of the primary and worker instances after processing, so objects held
+    // only in saved, non-current lists are missed. Sizes are shallow estimates, excluding the containers the objects own.
+    std::vector<const pandora::Pandora*> pandoraInstances(1, m_pPrimaryPandora);
+    for (const pandora::Pandora* const pPandora :
+         MultiPandoraApi::GetDaughterPandoraInstanceList(m_pPrimaryPandora))
+      pandoraInstances.push_back(pPandora);
+
+    MemoryUsage memoryUsage;
+
+    for (const pandora::Pandora* const pPandora : pandoraInstances) {
+      const pandora::CaloHitList* pCaloHitList(nullptr);
+      const pandora::MCParticleList* pMCParticleList(nullptr);
+      const pandora::ClusterList* pClusterList(nullptr);
+      const pandora::PfoList* pPfoList(nullptr);
+
+      if ((pandora::STATUS_CODE_SUCCESS == PandoraApi::GetCurrentList(*pPandora, pCaloHitList)) &&
+          pCaloHitList)
+        memoryUsage.m_nCaloHits += pCaloHitList->size();
+
+      if ((pandora::STATUS_CODE_SUCCESS ==
+           PandoraApi::GetCurrentList(*pPandora, pMCParticleList)) &&
+          pMCParticleList)
+        memoryUsage.m_nMCParticles += pMCParticleList->size();
+
+      if ((pandora::STATUS_CODE_SUCCESS == PandoraApi::GetCurrentList(*pPandora, pClusterList)) &&
+          pClusterList)
+        memoryUsage.m_nClusters += pClusterList->size();
+
+      if ((pandora::STATUS_CODE_SUCCESS == PandoraApi::GetCurrentList(*pPandora, pPfoList)) &&
+          pPfoList)
+        memoryUsage.m_nPfos += pPfoList->size();
+    }
+
+    memoryUsage.m_caloHitBytes = memoryUsage.m_nCaloHits * sizeof(lar_content::LArCaloHit);
+    memoryUsage.m_mcParticleBytes = memoryUsage.m_nMCParticles * sizeof(lar_content::LArMCParticle);
+    memoryUsage.m_clusterBytes = memoryUsage.m_nClusters * sizeof(pandora::Cluster);
+    memoryUsage.m_pfoBytes = memoryUsage.m_nPfos * sizeof(pandora::ParticleFlowObject);
+
+    m_eventMemoryUsage = memoryUsage;
+    ++m_nAccountedEvents;
+
+    m_totalMemoryUsage.m_nCaloHits += memoryUsage.m_nCaloHits;
+    m_totalMemoryUsage.m_caloHitBytes += memoryUsage.m_caloHitBytes;
+    m_totalMemoryUsage.m_nMCParticles += memoryUsage.m_nMCParticles;
+    m_totalMemoryUsage.m_mcParticleBytes += memoryUsage.m_mcParticleBytes;
+    m_totalMemoryUsage.m_nClusters += memoryUsage.m_nClusters;
+    m_totalMemoryUsage.m_clusterBytes += memoryUsage.m_clusterBytes;
+    m_totalMemoryUsage.m_nPfos += memoryUsage.m_nPfos;
+    m_totalMemoryUsage.m_pfoBytes += memoryUsage.m_pfoBytes;
+
+    m_maxMemoryUsage.m_nCaloHits = std::max(m_maxMemoryUsage.m_nCaloHits, memoryUsage.m_nCaloHits);
+    m_maxMemoryUsage.m_caloHitBytes =
+      std::max(m_maxMemoryUsage.m_caloHitBytes, memoryUsage.m_caloHitBytes);
+    m_maxMemoryUsage.m_nMCParticles =
+      std::max(m_maxMemoryUsage.m_nMCParticles, memoryUsage.m_nMCParticles);
+    m_maxMemoryUsage.m_mcParticleBytes =
+      std::max(m_maxMemoryUsage.m_mcParticleBytes, memoryUsage.m_mcParticleBytes);
+    m_maxMemoryUsage.m_nClusters = std::max(m_maxMemoryUsage.m_nClusters, memoryUsage.m_nClusters);
+    m_maxMemoryUsage.m_clusterBytes =
+      std::max(m_maxMemoryUsage.m_clusterBytes, memoryUsage.m_clusterBytes);
+    m_maxMemoryUsage.m_nPfos = std::max(m_maxMemoryUsage.m_nPfos, memoryUsage.m_nPfos);
+    m_maxMemoryUsage.m_pfoBytes = std::max(m_maxMemoryUsage.m_pfoBytes, memoryUsage.m_pfoBytes);
+
+    if (m_pMemoryTree) {
+      m_run = evt.run();
+      m_subrun = evt.subRun();
+      m_event = evt.event();
+      m_pMemoryTree->Fill();
+    }
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  LArPandora::MemoryUsage::MemoryUsage()
+    : m_nCaloHits(0)
+    , m_caloHitBytes(0)
+    , m_nMCParticles(0)
+    , m_mcParticleBytes(0)
+    , m_nClusters(0)
+    , m_clusterBytes(0)
+    , m_nPfos(0)
+    , m_pfoBytes(0)
+  {}
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
   fhicl::ParameterSet LArPandora::ConstructHitCollectionToolParameterSet(
     const fhicl::ParameterSet& pset)
   {
@@ -14,8 +14,11 @@
 
 #include "larpandora/LArPandoraInterface/LArPandoraHitCollectionTool.h"
 
+#include <cstddef>
 #include <string>
 
+class TTree;
+
 namespace lar_pandora {
 
   /**
@@ -32,11 +35,40 @@ namespace lar_pandora {
 
     void beginJob();
     void produce(art::Event& evt);
+    void endJob();
 
   protected:
+    /**
+     *  @brief  MemoryUsage class, the numbers and shallow estimated sizes of the Pandora objects in an event
+     */
+    class MemoryUsage {
+    public:
+      /**
+       *  @brief  Default constructor
+       */
+      MemoryUsage();
+
+      int m_nCaloHits;             ///< The number of calo hits in the current lists
+      long long m_caloHitBytes;    ///< The shallow estimated size of the calo hits
+      int m_nMCParticles;          ///< The number of mc particles in the current lists
+      long long m_mcParticleBytes; ///< The shallow estimated size of the mc particles
+      int m_nClusters;             ///< The number of clusters in the current lists
+      long long m_clusterBytes;    ///< The shallow estimated size of the clusters
+      int m_nPfos;                 ///< The number of pfos in the current lists
+      long long m_pfoBytes;        ///< The shallow estimated size of the pfos
+    };
+
     void CreatePandoraInput(art::Event& evt, IdToHitMap& idToHitMap);
     void ProcessPandoraOutput(art::Event& evt, const IdToHitMap& idToHitMap);
 
+    /**
+     *  @brief  Count the Pandora objects in the current lists of the primary and worker instances for the current event,
+     *          and make a shallow estimate of their size
+     *
+     *  @param  evt the art event
+     */
+    void AccountMemoryUsage(const art::Event& evt);
+
     fhicl::ParameterSet ConstructHitCollectionToolParameterSet(const fhicl::ParameterSet& pset);
 
     std::string m_configFile; ///< The config file
@@ -78,7 +110,25 @@ namespace lar_pandora {
     LArPandoraInput::Settings m_inputSettings;   ///< The lar pandora input settings
     LArPandoraOutput::Settings m_outputSettings; ///< The lar pandora output settings
 
-    LArDriftVolumeMap m_driftVolumeMap; ///< The map from volume id to drift volume
+    LArDriftVolumeMap m_driftVolumeMap; ///< The map from cryostat/tpc to drift volume
+
+    bool
+      m_enableMemoryAccounting; ///< Whether to report the memory used by the geometry and per-event Pandora objects
+    bool m_writeMemoryTree; ///< Whether to write the per-event memory usage to a tree
+
+    std::size_t m_driftVolumeBytes;    ///< The estimated size of the drift volume list
+    std::size_t m_driftVolumeMapBytes; ///< The estimated size of the drift volume map indices
+    std::size_t m_detectorGapBytes;    ///< The estimated size of the detector gap list
+
+    unsigned int m_nAccountedEvents; ///< The number of events with memory accounting
+    MemoryUsage m_eventMemoryUsage;  ///< The memory usage of the current event
+    MemoryUsage m_totalMemoryUsage;  ///< The memory usage summed over events
+    MemoryUsage m_maxMemoryUsage;    ///< The largest memory usage in any event
+
+    TTree* m_pMemoryTree; ///< The per-event memory usage tree
+    int m_run;            ///< The run number, for the memory usage tree
+    int m_subrun;         ///< The subrun number, for the memory usage tree
+    int m_event;          ///< The event number, for the memory usage tree
   };
 
 } // namespace lar_pandora
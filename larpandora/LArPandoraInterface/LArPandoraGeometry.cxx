@@ -17,8 +17,9 @@
 #include "larpandora/LArPandoraInterface/Detectors/GetDetectorType.h"
 #include "larpandora/LArPandoraInterface/Detectors/LArPandoraDetectorType.h"
 
+#include <algorithm>
 #include <iomanip>
-#include <set>
+#include <numeric>
 
 namespace lar_pandora {
 
@@ -35,21 +36,18 @@ namespace lar_pandora {
     LArPandoraGeometry::LoadGeometry(driftVolumeList, useActiveBoundingBox);
 
     LArPandoraDetectorType* detType(detector_functions::GetDetectorType());
+    const float maxDisplacement(LArDetectorGap::GetMaxGapSize());
 
-    for (LArDriftVolumeList::const_iterator iter1 = driftVolumeList.begin(),
-                                            iterEnd1 = driftVolumeList.end();
-         iter1 != iterEnd1;
-         ++iter1) {
-      const LArDriftVolume& driftVolume1 = *iter1;
+    // Find the pairs of drift volumes to check, a sweep in X skipping those too far apart to share a gap
+    std::vector<std::vector<unsigned int>> gapCandidates;
+    LArPandoraGeometry::FindDetectorGapCandidates(
+      driftVolumeList, detType->MaxDetectorGapX(maxDisplacement), gapCandidates);
 
-      for (LArDriftVolumeList::const_iterator iter2 = iter1, iterEnd2 = driftVolumeList.end();
-           iter2 != iterEnd2;
-           ++iter2) {
-        const LArDriftVolume& driftVolume2 = *iter2;
+    for (unsigned int index1 = 0; index1 < driftVolumeList.size(); ++index1) {
+      const LArDriftVolume& driftVolume1 = driftVolumeList.at(index1);
 
-        if (driftVolume1.GetVolumeID() == driftVolume2.GetVolumeID()) continue;
-
-        const float maxDisplacement(LArDetectorGap::GetMaxGapSize());
+      for (const unsigned int index2 : gapCandidates.at(index1)) {
+        const LArDriftVolume& driftVolume2 = driftVolumeList.at(index2);
 
         const float deltaX(std::fabs(driftVolume1.GetCenterX() - driftVolume2.GetCenterX()));
         const float deltaY(std::fabs(driftVolume1.GetCenterY() - driftVolume2.GetCenterY()));
@@ -86,12 +84,63 @@ namespace lar_pandora {
         }
       }
 
-      detType->LoadDaughterDetectorGaps(driftVolume1, LArDetectorGap::GetMaxGapSize(), listOfGaps);
+      detType->LoadDaughterDetectorGaps(driftVolume1, maxDisplacement, listOfGaps);
     }
   }
 
   //------------------------------------------------------------------------------------------------------------------------------------------
 
+  void LArPandoraGeometry::FindDetectorGapCandidates(
+    const LArDriftVolumeList& driftVolumeList,
+    const float maxGapX,
+    std::vector<std::vector<unsigned int>>& gapCandidates)
+  {
+    // ATTN A small tolerance guards against rounding, as the candidates are then checked in full
+    const float sweepTolerance(1.f);
+    const unsigned int nVolumes(driftVolumeList.size());
+
+    std::vector<unsigned int> sortedIndices(nVolumes);
+    std::iota(sortedIndices.begin(), sortedIndices.end(), 0);
+    std::sort(sortedIndices.begin(),
+              sortedIndices.end(),
+              [&driftVolumeList](const unsigned int lhs, const unsigned int rhs) {
+                return (LArPandoraGeometry::GetMinX(driftVolumeList.at(lhs)) <
+                        LArPandoraGeometry::GetMinX(driftVolumeList.at(rhs)));
+              });
+
+    gapCandidates.assign(nVolumes, std::vector<unsigned int>());
+
+    for (unsigned int sorted1 = 0; sorted1 < nVolumes; ++sorted1) {
+      const unsigned int index1(sortedIndices.at(sorted1));
+      const LArDriftVolume& driftVolume1(driftVolumeList.at(index1));
+      const float maxX1(driftVolume1.GetCenterX() + 0.5f * driftVolume1.GetWidthX());
+
+      for (unsigned int sorted2 = sorted1 + 1; sorted2 < nVolumes; ++sorted2) {
+        const unsigned int index2(sortedIndices.at(sorted2));
+
+        // Volumes are sorted by their lower X edge, so all remaining volumes are further away
+        if (LArPandoraGeometry::GetMinX(driftVolumeList.at(index2)) - maxX1 >
+            maxGapX + sweepTolerance)
+          break;
+
+        gapCandidates.at(std::min(index1, index2)).push_back(std::max(index1, index2));
+      }
+    }
+
+    // Visit the pairs in drift volume list order, so that the gaps are listed as by an all-pairs loop
+    for (std::vector<unsigned int>& candidates : gapCandidates)
+      std::sort(candidates.begin(), candidates.end());
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  float LArPandoraGeometry::GetMinX(const LArDriftVolume& driftVolume)
+  {
+    return (driftVolume.GetCenterX() - 0.5f * driftVolume.GetWidthX());
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
   void LArPandoraGeometry::LoadGeometry(LArDriftVolumeList& outputVolumeList,
                                         LArDriftVolumeMap& outputVolumeMap,
                                         const bool useActiveBoundingBox)
@@ -102,13 +151,22 @@ namespace lar_pandora {
 
     LArPandoraGeometry::LoadGeometry(outputVolumeList, useActiveBoundingBox);
 
-    // Create mapping between tpc/cstat labels and drift volumes
-    for (const LArDriftVolume& driftVolume : outputVolumeList) {
-      for (const LArDaughterDriftVolume& tpcVolume : driftVolume.GetTpcVolumeList()) {
-        (void)outputVolumeMap.insert(LArDriftVolumeMap::value_type(
-          LArPandoraGeometry::GetTpcID(tpcVolume.GetCryostat(), tpcVolume.GetTpc()), driftVolume));
+    // Create mapping between tpc/cstat labels and positions in a single, shared copy of the drift volume list
+    LArDriftVolumeMap::TpcIndicesMap tpcIndicesMap;
+    for (unsigned int volumeIndex = 0; volumeIndex < outputVolumeList.size(); ++volumeIndex) {
+      const LArDaughterDriftVolumeList& tpcVolumeList(
+        outputVolumeList.at(volumeIndex).GetTpcVolumeList());
+
+      for (unsigned int daughterIndex = 0; daughterIndex < tpcVolumeList.size(); ++daughterIndex) {
+        const LArDaughterDriftVolume& tpcVolume(tpcVolumeList.at(daughterIndex));
+        (void)tpcIndicesMap.insert(LArDriftVolumeMap::TpcIndicesMap::value_type(
+          LArPandoraGeometry::GetTpcID(tpcVolume.GetCryostat(), tpcVolume.GetTpc()),
+          LArDriftVolumeMap::Indices(volumeIndex, daughterIndex)));
       }
     }
+
+    outputVolumeMap =
+      LArDriftVolumeMap(std::make_shared<const LArDriftVolumeList>(outputVolumeList), tpcIndicesMap);
   }
 
   //------------------------------------------------------------------------------------------------------------------------------------------
@@ -116,19 +174,28 @@ namespace lar_pandora {
   unsigned int LArPandoraGeometry::GetVolumeID(const LArDriftVolumeMap& driftVolumeMap,
                                                const unsigned int cstat,
                                                const unsigned int tpc)
+  {
+    return LArPandoraGeometry::GetDriftVolume(driftVolumeMap, cstat, tpc).GetVolumeID();
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  const LArDriftVolume& LArPandoraGeometry::GetDriftVolume(const LArDriftVolumeMap& driftVolumeMap,
+                                                           const unsigned int cstat,
+                                                           const unsigned int tpc)
   {
     if (driftVolumeMap.empty())
       throw cet::exception("LArPandora")
-        << " LArPandoraGeometry::GetVolumeID --- detector geometry map is empty";
+        << " LArPandoraGeometry::GetDriftVolume --- detector geometry map is empty";
 
-    LArDriftVolumeMap::const_iterator iter =
-      driftVolumeMap.find(LArPandoraGeometry::GetTpcID(cstat, tpc));
+    const LArDriftVolumeMap::Indices* const pIndices(
+      driftVolumeMap.GetIndices(LArPandoraGeometry::GetTpcID(cstat, tpc)));
 
-    if (driftVolumeMap.end() == iter)
-      throw cet::exception("LArPandora")
-        << " LArPandoraGeometry::GetVolumeID --- found a TPC that doesn't belong to a drift volume";
+    if (!pIndices)
+      throw cet::exception("LArPandora") << " LArPandoraGeometry::GetDriftVolume --- found a TPC "
+                                            "that doesn't belong to a drift volume";
 
-    return iter->second.GetVolumeID();
+    return driftVolumeMap.GetDriftVolume(pIndices->m_volumeIndex);
   }
 
   //------------------------------------------------------------------------------------------------------------------------------------------
@@ -141,25 +208,14 @@ namespace lar_pandora {
       throw cet::exception("LArPandora")
         << " LArPandoraGeometry::GetDaughterVolumeID --- detector geometry map is empty";
 
-    LArDriftVolumeMap::const_iterator iter =
-      driftVolumeMap.find(LArPandoraGeometry::GetTpcID(cstat, tpc));
+    const LArDriftVolumeMap::Indices* const pIndices(
+      driftVolumeMap.GetIndices(LArPandoraGeometry::GetTpcID(cstat, tpc)));
 
-    if (driftVolumeMap.end() == iter)
+    if (!pIndices)
       throw cet::exception("LArPandora") << " LArPandoraGeometry::GetDaughterVolumeID --- found a "
                                             "TPC volume that doesn't belong to a drift volume";
 
-    for (LArDaughterDriftVolumeList::const_iterator
-           iterDghtr = iter->second.GetTpcVolumeList().begin(),
-           iterDghtrEnd = iter->second.GetTpcVolumeList().end();
-         iterDghtr != iterDghtrEnd;
-         ++iterDghtr) {
-      const LArDaughterDriftVolume& daughterVolume(*iterDghtr);
-      if (cstat == daughterVolume.GetCryostat() && tpc == daughterVolume.GetTpc())
-        return std::distance(iter->second.GetTpcVolumeList().begin(), iterDghtr);
-    }
-    throw cet::exception("LArPandora")
-      << " LArPandoraGeometry::GetDaughterVolumeID --- found a daughter volume that doesn't belong "
-         "to the drift volume ";
+    return pIndices->m_daughterIndex;
   }
 
   //------------------------------------------------------------------------------------------------------------------------------------------
@@ -168,19 +224,47 @@ namespace lar_pandora {
                                                 const unsigned int tpc,
                                                 const geo::View_t hit_View)
   {
-    const bool switchUV(LArPandoraGeometry::ShouldSwitchUV(cstat, tpc));
+    return LArPandoraGeometry::GetGlobalViewTable().GetGlobalView(cstat, tpc, hit_View);
+  }
 
-    // ATTN This implicitly assumes that there will be u, v and (maybe) one of either w or y views
-    if ((hit_View == geo::kW) || (hit_View == geo::kY)) { return hit_View; }
-    else if (hit_View == geo::kU) {
-      return (switchUV ? geo::kV : geo::kU);
-    }
-    else if (hit_View == geo::kV) {
-      return (switchUV ? geo::kU : geo::kV);
-    }
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  std::size_t LArPandoraGeometry::GetMemoryUsage(const LArDriftVolumeList& driftVolumeList)
+  {
+    std::size_t memoryUsage(driftVolumeList.capacity() * sizeof(LArDriftVolume));
+
+    for (const LArDriftVolume& driftVolume : driftVolumeList)
+      memoryUsage += driftVolume.GetTpcVolumeList().capacity() * sizeof(LArDaughterDriftVolume);
+
+    return memoryUsage;
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  std::size_t LArPandoraGeometry::GetMemoryUsage(const LArDetectorGapList& listOfGaps)
+  {
+    return (listOfGaps.capacity() * sizeof(LArDetectorGap));
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
 
-    throw cet::exception("LArPandora")
-      << " LArPandoraGeometry::GetGlobalView --- found an unknown plane view (not U, V or W) ";
+  std::size_t LArPandoraGeometry::GetMemoryUsage(const LArDriftVolumeMap& driftVolumeMap)
+  {
+    // ATTN Estimate for a node-based hash map: a pointer per bucket, plus a node holding the entry and a link per entry
+    const LArDriftVolumeMap::TpcIndicesMap& tpcIndicesMap(driftVolumeMap.GetTpcIndicesMap());
+
+    return (sizeof(LArDriftVolumeMap) + tpcIndicesMap.bucket_count() * sizeof(void*) +
+            tpcIndicesMap.size() *
+              (sizeof(LArDriftVolumeMap::TpcIndicesMap::value_type) + sizeof(void*)));
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  const LArPandoraGeometry::GlobalViewTable& LArPandoraGeometry::GetGlobalViewTable()
+  {
+    // ATTN The geometry is fixed for the job, so the table is built once, on first use
+    static const GlobalViewTable globalViewTable;
+    return globalViewTable;
   }
 
   //------------------------------------------------------------------------------------------------------------------------------------------
@@ -199,12 +283,7 @@ namespace lar_pandora {
 
   bool LArPandoraGeometry::ShouldSwitchUV(const unsigned int cstat, const unsigned int tpc)
   {
-    // We determine whether U and V views should be switched by checking the drift direction
-    art::ServiceHandle<geo::Geometry const> theGeometry;
-    const geo::TPCGeo& theTpc{theGeometry->TPC(geo::TPCID(cstat, tpc))};
-
-    const bool isPositiveDrift(theTpc.DriftDirection() == geo::kPosX);
-    return LArPandoraGeometry::ShouldSwitchUV(isPositiveDrift);
+    return LArPandoraGeometry::GetGlobalViewTable().ShouldSwitchUV(cstat, tpc);
   }
 
   //------------------------------------------------------------------------------------------------------------------------------------------
@@ -230,150 +309,98 @@ namespace lar_pandora {
       throw cet::exception("LArPandora")
         << " LArPandoraGeometry::LoadGeometry --- detector geometry has already been loaded ";
 
-    typedef std::set<unsigned int> UIntSet;
-
     // Pandora requires three independent images, and ability to correlate features between images (via wire angles and transformation plugin).
     art::ServiceHandle<geo::Geometry const> theGeometry;
     LArPandoraDetectorType* detType(detector_functions::GetDetectorType());
     const float wirePitchU(detType->WirePitchU());
     const float wirePitchV(detType->WirePitchV());
     const float wirePitchW(detType->WirePitchW());
-    const float maxDeltaTheta(0.01f); // leave this hard-coded for now
 
     // Loop over cryostats
     for (auto const& cryostat : theGeometry->Iterate<geo::CryostatGeo>()) {
       auto const icstat = cryostat.ID().Cryostat;
-      UIntSet cstatList;
-
-      // Loop over TPCs in in this cryostat
-      for (auto const& theTpc1 : theGeometry->Iterate<geo::TPCGeo>(cryostat.ID())) {
-        auto const itpc1 = theTpc1.ID().TPC;
-        if (cstatList.end() != cstatList.find(itpc1)) continue;
-
-        // Use this TPC to seed a drift volume
-        cstatList.insert(itpc1);
-
-        const float wireAngleU(detType->WireAngleU(itpc1, icstat));
-        const float wireAngleV(detType->WireAngleV(itpc1, icstat));
-        const float wireAngleW(detType->WireAngleW(itpc1, icstat));
-
-        auto const worldCoord1 = theTpc1.GetCenter();
-
-        float driftMinX(useActiveBoundingBox ? theTpc1.ActiveBoundingBox().MinX() :
-                                               (worldCoord1.X() - theTpc1.ActiveHalfWidth()));
-        float driftMaxX(useActiveBoundingBox ? theTpc1.ActiveBoundingBox().MaxX() :
-                                               (worldCoord1.X() + theTpc1.ActiveHalfWidth()));
-        float driftMinY(useActiveBoundingBox ? theTpc1.ActiveBoundingBox().MinY() :
-                                               (worldCoord1.Y() - theTpc1.ActiveHalfHeight()));
-        float driftMaxY(useActiveBoundingBox ? theTpc1.ActiveBoundingBox().MaxY() :
-                                               (worldCoord1.Y() + theTpc1.ActiveHalfHeight()));
-        float driftMinZ(useActiveBoundingBox ? theTpc1.ActiveBoundingBox().MinZ() :
-                                               (worldCoord1.Z() - 0.5f * theTpc1.ActiveLength()));
-        float driftMaxZ(useActiveBoundingBox ? theTpc1.ActiveBoundingBox().MaxZ() :
-                                               (worldCoord1.Z() + 0.5f * theTpc1.ActiveLength()));
-
-        const double min1(
-          useActiveBoundingBox ?
-            (0.5 * (driftMinX + driftMaxX) - 0.25 * std::fabs(driftMaxX - driftMinX)) :
-            (worldCoord1.X() - 0.5 * theTpc1.ActiveHalfWidth()));
-        const double max1(
-          useActiveBoundingBox ?
-            (0.5 * (driftMinX + driftMaxX) + 0.25 * std::fabs(driftMaxX - driftMinX)) :
-            (worldCoord1.X() + 0.5 * theTpc1.ActiveHalfWidth()));
-
-        const bool isPositiveDrift(theTpc1.DriftDirection() == geo::kPosX);
-
-        UIntSet tpcList;
-        tpcList.insert(itpc1);
+
+      // Collect the bounds, drift direction and wire angles of each TPC in this cryostat, in geometry order
+      std::vector<TpcSummary> tpcSummaries;
+      for (auto const& theTpc : theGeometry->Iterate<geo::TPCGeo>(cryostat.ID())) {
+        auto const itpc = theTpc.ID().TPC;
+        auto const worldCoord = theTpc.GetCenter();
+
+        TpcSummary tpcSummary;
+        tpcSummary.m_tpc = itpc;
+        tpcSummary.m_isPositiveDrift = (theTpc.DriftDirection() == geo::kPosX);
+        tpcSummary.m_driftDirection = static_cast<int>(theTpc.DriftDirection());
+        tpcSummary.m_wireAngleU = detType->WireAngleU(itpc, icstat);
+        tpcSummary.m_wireAngleV = detType->WireAngleV(itpc, icstat);
+        tpcSummary.m_wireAngleW = detType->WireAngleW(itpc, icstat);
+        tpcSummary.m_minX = (useActiveBoundingBox ?
+                               theTpc.ActiveBoundingBox().MinX() :
+                               (worldCoord.X() - theTpc.ActiveHalfWidth()));
+        tpcSummary.m_maxX = (useActiveBoundingBox ?
+                               theTpc.ActiveBoundingBox().MaxX() :
+                               (worldCoord.X() + theTpc.ActiveHalfWidth()));
+        tpcSummary.m_minY = (useActiveBoundingBox ?
+                               theTpc.ActiveBoundingBox().MinY() :
+                               (worldCoord.Y() - theTpc.ActiveHalfHeight()));
+        tpcSummary.m_maxY = (useActiveBoundingBox ?
+                               theTpc.ActiveBoundingBox().MaxY() :
+                               (worldCoord.Y() + theTpc.ActiveHalfHeight()));
+        tpcSummary.m_minZ = (useActiveBoundingBox ?
+                               theTpc.ActiveBoundingBox().MinZ() :
+                               (worldCoord.Z() - 0.5f * theTpc.ActiveLength()));
+        tpcSummary.m_maxZ = (useActiveBoundingBox ?
+                               theTpc.ActiveBoundingBox().MaxZ() :
+                               (worldCoord.Z() + 0.5f * theTpc.ActiveLength()));
+
+        // The central half of the drift coordinate range, used to decide whether TPCs overlap in X
+        tpcSummary.m_centralMinX =
+          (useActiveBoundingBox ? (0.5 * (tpcSummary.m_minX + tpcSummary.m_maxX) -
+                                   0.25 * std::fabs(tpcSummary.m_maxX - tpcSummary.m_minX)) :
+                                  (worldCoord.X() - 0.5 * theTpc.ActiveHalfWidth()));
+        tpcSummary.m_centralMaxX =
+          (useActiveBoundingBox ? (0.5 * (tpcSummary.m_minX + tpcSummary.m_maxX) +
+                                   0.25 * std::fabs(tpcSummary.m_maxX - tpcSummary.m_minX)) :
+                                  (worldCoord.X() + 0.5 * theTpc.ActiveHalfWidth()));
+
+        tpcSummaries.push_back(tpcSummary);
+      }
+
+      // Group the TPCs into drift volumes, each listing its seed TPC and then its other TPCs in geometry order
+      std::vector<std::vector<unsigned int>> tpcGroups;
+      LArPandoraGeometry::GroupTpcs(tpcSummaries, tpcGroups);
+
+      for (const std::vector<unsigned int>& tpcGroup : tpcGroups) {
+        const TpcSummary& tpc1(tpcSummaries.at(tpcGroup.front()));
+
+        float driftMinX(tpc1.m_minX), driftMaxX(tpc1.m_maxX);
+        float driftMinY(tpc1.m_minY), driftMaxY(tpc1.m_maxY);
+        float driftMinZ(tpc1.m_minZ), driftMaxZ(tpc1.m_maxZ);
 
         LArDaughterDriftVolumeList tpcVolumeList;
-        tpcVolumeList.emplace_back(LArDaughterDriftVolume(icstat,
-                                                          itpc1,
-                                                          0.5f * (driftMaxX + driftMinX),
-                                                          0.5f * (driftMaxY + driftMinY),
-                                                          0.5f * (driftMaxZ + driftMinZ),
-                                                          (driftMaxX - driftMinX),
-                                                          (driftMaxY - driftMinY),
-                                                          (driftMaxZ - driftMinZ)));
-
-        // Now identify the other TPCs associated with this drift volume
-        for (auto const& theTpc2 : theGeometry->Iterate<geo::TPCGeo>(cryostat.ID())) {
-          auto const itpc2 = theTpc2.ID().TPC;
-          if (cstatList.end() != cstatList.find(itpc2)) continue;
-
-          if (theTpc1.DriftDirection() != theTpc2.DriftDirection()) continue;
-
-          const float dThetaU(detType->WireAngleU(itpc1, icstat) -
-                              detType->WireAngleU(itpc2, icstat));
-          const float dThetaV(detType->WireAngleV(itpc1, icstat) -
-                              detType->WireAngleV(itpc2, icstat));
-          const float dThetaW(detType->WireAngleW(itpc1, icstat) -
-                              detType->WireAngleW(itpc2, icstat));
-          if (dThetaU > maxDeltaTheta || dThetaV > maxDeltaTheta || dThetaW > maxDeltaTheta)
-            continue;
-
-          auto const worldCoord2 = theTpc2.GetCenter();
-
-          const float driftMinX2(useActiveBoundingBox ?
-                                   theTpc2.ActiveBoundingBox().MinX() :
-                                   (worldCoord2.X() - theTpc2.ActiveHalfWidth()));
-          const float driftMaxX2(useActiveBoundingBox ?
-                                   theTpc2.ActiveBoundingBox().MaxX() :
-                                   (worldCoord2.X() + theTpc2.ActiveHalfWidth()));
-
-          const double min2(
-            useActiveBoundingBox ?
-              (0.5 * (driftMinX2 + driftMaxX2) - 0.25 * std::fabs(driftMaxX2 - driftMinX2)) :
-              (worldCoord2.X() - 0.5 * theTpc2.ActiveHalfWidth()));
-          const double max2(
-            useActiveBoundingBox ?
-              (0.5 * (driftMinX2 + driftMaxX2) + 0.25 * std::fabs(driftMaxX2 - driftMinX2)) :
-              (worldCoord2.X() + 0.5 * theTpc2.ActiveHalfWidth()));
-
-          if ((min2 > max1) || (min1 > max2)) continue;
-
-          cstatList.insert(itpc2);
-          tpcList.insert(itpc2);
-
-          const float driftMinY2(useActiveBoundingBox ?
-                                   theTpc2.ActiveBoundingBox().MinY() :
-                                   (worldCoord2.Y() - theTpc2.ActiveHalfHeight()));
-          const float driftMaxY2(useActiveBoundingBox ?
-                                   theTpc2.ActiveBoundingBox().MaxY() :
-                                   (worldCoord2.Y() + theTpc2.ActiveHalfHeight()));
-          const float driftMinZ2(useActiveBoundingBox ?
-                                   theTpc2.ActiveBoundingBox().MinZ() :
-                                   (worldCoord2.Z() - 0.5f * theTpc2.ActiveLength()));
-          const float driftMaxZ2(useActiveBoundingBox ?
-                                   theTpc2.ActiveBoundingBox().MaxZ() :
-                                   (worldCoord2.Z() + 0.5f * theTpc2.ActiveLength()));
-
-          driftMinX = std::min(driftMinX, driftMinX2);
-          driftMaxX = std::max(driftMaxX, driftMaxX2);
-          driftMinY = std::min(driftMinY, driftMinY2);
-          driftMaxY = std::max(driftMaxY, driftMaxY2);
-          driftMinZ = std::min(driftMinZ, driftMinZ2);
-          driftMaxZ = std::max(driftMaxZ, driftMaxZ2);
-
-          tpcVolumeList.emplace_back(LArDaughterDriftVolume(icstat,
-                                                            itpc2,
-                                                            0.5f * (driftMaxX2 + driftMinX2),
-                                                            0.5f * (driftMaxY2 + driftMinY2),
-                                                            0.5f * (driftMaxZ2 + driftMinZ2),
-                                                            (driftMaxX2 - driftMinX2),
-                                                            (driftMaxY2 - driftMinY2),
-                                                            (driftMaxZ2 - driftMinZ2)));
+        tpcVolumeList.emplace_back(LArPandoraGeometry::MakeDaughterDriftVolume(icstat, tpc1));
+
+        for (unsigned int iTpc = 1; iTpc < tpcGroup.size(); ++iTpc) {
+          const TpcSummary& tpc2(tpcSummaries.at(tpcGroup.at(iTpc)));
+
+          driftMinX = std::min(driftMinX, tpc2.m_minX);
+          driftMaxX = std::max(driftMaxX, tpc2.m_maxX);
+          driftMinY = std::min(driftMinY, tpc2.m_minY);
+          driftMaxY = std::max(driftMaxY, tpc2.m_maxY);
+          driftMinZ = std::min(driftMinZ, tpc2.m_minZ);
+          driftMaxZ = std::max(driftMaxZ, tpc2.m_maxZ);
+
+          tpcVolumeList.emplace_back(LArPandoraGeometry::MakeDaughterDriftVolume(icstat, tpc2));
         }
 
         // Create new daughter drift volume (volume ID = 0 to N-1)
         driftVolumeList.emplace_back(driftVolumeList.size(),
-                                     isPositiveDrift,
+                                     tpc1.m_isPositiveDrift,
                                      wirePitchU,
                                      wirePitchV,
                                      wirePitchW,
-                                     wireAngleU,
-                                     wireAngleV,
-                                     wireAngleW,
+                                     tpc1.m_wireAngleU,
+                                     tpc1.m_wireAngleV,
+                                     tpc1.m_wireAngleW,
                                      0.5f * (driftMaxX + driftMinX),
                                      0.5f * (driftMaxY + driftMinY),
                                      0.5f * (driftMaxZ + driftMinZ),
@@ -392,6 +419,100 @@ namespace lar_pandora {
 
   //------------------------------------------------------------------------------------------------------------------------------------------
 
+  void LArPandoraGeometry::GroupTpcs(const std::vector<TpcSummary>& tpcSummaries,
+                                     std::vector<std::vector<unsigned int>>& tpcGroups)
+  {
+    const float maxDeltaTheta(0.01f); // leave this hard-coded for now
+
+    // ATTN A small tolerance guards against rounding in the sweep, as the candidates are then checked in full
+    const double sweepTolerance(1.);
+
+    // Sort the TPCs by the lower edge of their central X range, so that the TPCs overlapping a seed can be found by a sweep
+    const unsigned int nTpcs(tpcSummaries.size());
+    std::vector<unsigned int> sortedIndices(nTpcs);
+    std::iota(sortedIndices.begin(), sortedIndices.end(), 0);
+    std::sort(sortedIndices.begin(),
+              sortedIndices.end(),
+              [&tpcSummaries](const unsigned int lhs, const unsigned int rhs) {
+                return (tpcSummaries.at(lhs).m_centralMinX < tpcSummaries.at(rhs).m_centralMinX);
+              });
+
+    std::vector<double> sortedMinX;
+    double maxCentralWidthX(0.);
+    for (const unsigned int index : sortedIndices) {
+      const TpcSummary& tpcSummary(tpcSummaries.at(index));
+      sortedMinX.push_back(tpcSummary.m_centralMinX);
+      maxCentralWidthX =
+        std::max(maxCentralWidthX, tpcSummary.m_centralMaxX - tpcSummary.m_centralMinX);
+    }
+
+    tpcGroups.clear();
+    std::vector<bool> isAssigned(nTpcs, false);
+
+    for (unsigned int index1 = 0; index1 < nTpcs; ++index1) {
+      if (isAssigned.at(index1)) continue;
+
+      // Use this TPC to seed a drift volume
+      isAssigned.at(index1) = true;
+      const TpcSummary& tpc1(tpcSummaries.at(index1));
+
+      // Now identify the other TPCs associated with this drift volume. Only TPCs whose central X range starts
+      // within [min1 - maxCentralWidthX, max1] can overlap that of the seed.
+      const std::vector<double>::const_iterator sweepBegin(
+        std::lower_bound(sortedMinX.begin(),
+                         sortedMinX.end(),
+                         tpc1.m_centralMinX - maxCentralWidthX - sweepTolerance));
+      const std::vector<double>::const_iterator sweepEnd(
+        std::upper_bound(sweepBegin, sortedMinX.cend(), tpc1.m_centralMaxX));
+
+      std::vector<unsigned int> tpcGroup;
+      for (std::vector<double>::const_iterator iter = sweepBegin; iter != sweepEnd; ++iter) {
+        const unsigned int index2(sortedIndices.at(iter - sortedMinX.cbegin()));
+        if (isAssigned.at(index2)) continue;
+
+        const TpcSummary& tpc2(tpcSummaries.at(index2));
+        if (tpc1.m_driftDirection != tpc2.m_driftDirection) continue;
+
+        const float dThetaU(tpc1.m_wireAngleU - tpc2.m_wireAngleU);
+        const float dThetaV(tpc1.m_wireAngleV - tpc2.m_wireAngleV);
+        const float dThetaW(tpc1.m_wireAngleW - tpc2.m_wireAngleW);
+        if (dThetaU > maxDeltaTheta || dThetaV > maxDeltaTheta || dThetaW > maxDeltaTheta)
+          continue;
+
+        if ((tpc2.m_centralMinX > tpc1.m_centralMaxX) || (tpc1.m_centralMinX > tpc2.m_centralMaxX))
+          continue;
+
+        tpcGroup.push_back(index2);
+      }
+
+      // Other TPCs are listed in geometry order, after the seed
+      std::sort(tpcGroup.begin(), tpcGroup.end());
+
+      for (const unsigned int index2 : tpcGroup)
+        isAssigned.at(index2) = true;
+
+      tpcGroup.insert(tpcGroup.begin(), index1);
+      tpcGroups.push_back(tpcGroup);
+    }
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  LArDaughterDriftVolume LArPandoraGeometry::MakeDaughterDriftVolume(const unsigned int cstat,
+                                                                     const TpcSummary& tpcSummary)
+  {
+    return LArDaughterDriftVolume(cstat,
+                                  tpcSummary.m_tpc,
+                                  0.5f * (tpcSummary.m_maxX + tpcSummary.m_minX),
+                                  0.5f * (tpcSummary.m_maxY + tpcSummary.m_minY),
+                                  0.5f * (tpcSummary.m_maxZ + tpcSummary.m_minZ),
+                                  (tpcSummary.m_maxX - tpcSummary.m_minX),
+                                  (tpcSummary.m_maxY - tpcSummary.m_minY),
+                                  (tpcSummary.m_maxZ - tpcSummary.m_minZ));
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
   void LArPandoraGeometry::LoadGlobalDaughterGeometry(const LArDriftVolumeList& driftVolumeList,
                                                       LArDriftVolumeList& daughterVolumeList)
   {
@@ -452,6 +573,90 @@ namespace lar_pandora {
   //------------------------------------------------------------------------------------------------------------------------------------------
   //------------------------------------------------------------------------------------------------------------------------------------------
 
+  LArPandoraGeometry::GlobalViewTable::GlobalViewTable()
+  {
+    art::ServiceHandle<geo::Geometry const> theGeometry;
+
+    for (auto const& cryostat : theGeometry->Iterate<geo::CryostatGeo>()) {
+      const unsigned int icstat(cryostat.ID().Cryostat);
+
+      if (icstat >= m_nTpcs.size()) {
+        m_firstTpcIndex.resize(icstat + 1, 0);
+        m_nTpcs.resize(icstat + 1, 0);
+      }
+
+      m_firstTpcIndex[icstat] = m_switchUV.size();
+      m_nTpcs[icstat] = cryostat.NTPC();
+
+      for (auto const& theTpc : theGeometry->Iterate<geo::TPCGeo>(cryostat.ID())) {
+        if (theTpc.ID().TPC != m_switchUV.size() - m_firstTpcIndex[icstat])
+          throw cet::exception("LArPandora") << " LArPandoraGeometry::GlobalViewTable --- found "
+                                                "non-consecutive TPC IDs in a cryostat ";
+
+        // We determine whether U and V views should be switched by checking the drift direction
+        const bool isPositiveDrift(theTpc.DriftDirection() == geo::kPosX);
+        const bool switchUV(LArPandoraGeometry::ShouldSwitchUV(isPositiveDrift));
+        m_switchUV.push_back(switchUV);
+
+        // ATTN This implicitly assumes that there will be u, v and (maybe) one of either w or y views
+        for (unsigned int iview = 0; iview < m_nViews; ++iview) {
+          const geo::View_t view(static_cast<geo::View_t>(iview));
+
+          if ((view == geo::kW) || (view == geo::kY))
+            m_globalViews.push_back(view);
+          else if (view == geo::kU)
+            m_globalViews.push_back(switchUV ? geo::kV : geo::kU);
+          else if (view == geo::kV)
+            m_globalViews.push_back(switchUV ? geo::kU : geo::kV);
+          else
+            m_globalViews.push_back(geo::kUnknown);
+        }
+      }
+    }
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  geo::View_t LArPandoraGeometry::GlobalViewTable::GetGlobalView(const unsigned int cstat,
+                                                                 const unsigned int tpc,
+                                                                 const geo::View_t hit_View) const
+  {
+    const unsigned int tpcIndex(this->GetTpcIndex(cstat, tpc));
+    const unsigned int iview(static_cast<unsigned int>(hit_View));
+    const geo::View_t globalView(
+      (iview < m_nViews) ? m_globalViews[tpcIndex * m_nViews + iview] : geo::kUnknown);
+
+    if (geo::kUnknown == globalView)
+      throw cet::exception("LArPandora")
+        << " LArPandoraGeometry::GetGlobalView --- found an unknown plane view (not U, V or W) ";
+
+    return globalView;
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  bool LArPandoraGeometry::GlobalViewTable::ShouldSwitchUV(const unsigned int cstat,
+                                                           const unsigned int tpc) const
+  {
+    return m_switchUV[this->GetTpcIndex(cstat, tpc)];
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  unsigned int LArPandoraGeometry::GlobalViewTable::GetTpcIndex(const unsigned int cstat,
+                                                                const unsigned int tpc) const
+  {
+    if ((cstat >= m_nTpcs.size()) || (tpc >= m_nTpcs[cstat]))
+      throw cet::exception("LArPandora")
+        << " LArPandoraGeometry::GlobalViewTable --- found an unknown cryostat/tpc (" << cstat
+        << ", " << tpc << ") ";
+
+    return m_firstTpcIndex[cstat] + tpc;
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
   LArDriftVolume::LArDriftVolume(const unsigned int volumeID,
                                  const bool isPositiveDrift,
                                  const float wirePitchU,
@@ -11,6 +11,7 @@
 
 #include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
 
+#include <cstddef>
 #include <map>
 #include <vector>
 
@@ -51,6 +52,17 @@ namespace lar_pandora {
                                     const unsigned int cstat,
                                     const unsigned int tpc);
 
+    /**
+     *  @brief  Get the drift volume for a specified cryostat/tpc pair
+     *
+     *  @param  driftVolumeMap the output mapping between cryostat/tpc and drift volumes
+     *  @param  cstat the input cryostat unique ID
+     *  @param  tpc the input tpc unique ID
+     */
+    static const LArDriftVolume& GetDriftVolume(const LArDriftVolumeMap& driftVolumeMap,
+                                                const unsigned int cstat,
+                                                const unsigned int tpc);
+
     /**
      *  @brief  Get daughter volume ID from a specified cryostat/tpc pair
      *
@@ -73,7 +85,128 @@ namespace lar_pandora {
                                      const unsigned int tpc,
                                      const geo::View_t hit_View);
 
+    /**
+     *  @brief  Estimate the memory held by a list of drift volumes, including their daughter volumes
+     *
+     *  @param  driftVolumeList the list of drift volumes
+     *
+     *  @return the estimated number of bytes
+     */
+    static std::size_t GetMemoryUsage(const LArDriftVolumeList& driftVolumeList);
+
+    /**
+     *  @brief  Estimate the memory held by a list of detector gaps
+     *
+     *  @param  listOfGaps the list of detector gaps
+     *
+     *  @return the estimated number of bytes
+     */
+    static std::size_t GetMemoryUsage(const LArDetectorGapList& listOfGaps);
+
+    /**
+     *  @brief  Estimate the memory held by the tpc indices of a drift volume map, excluding the shared drift volume list
+     *
+     *  @param  driftVolumeMap the drift volume map
+     *
+     *  @return the estimated number of bytes
+     */
+    static std::size_t GetMemoryUsage(const LArDriftVolumeMap& driftVolumeMap);
+
+    /**
+     *  @brief  TpcSummary class, the quantities of a TPC needed to group TPCs into drift volumes
+     */
+    class TpcSummary {
+    public:
+      unsigned int m_tpc;     ///< The tpc
+      bool m_isPositiveDrift; ///< Whether the drift is along positive X
+      int m_driftDirection;   ///< The drift direction
+      float m_wireAngleU;     ///< The U wire angle
+      float m_wireAngleV;     ///< The V wire angle
+      float m_wireAngleW;     ///< The W wire angle
+      float m_minX;           ///< The min X of the tpc
+      float m_maxX;           ///< The max X of the tpc
+      float m_minY;           ///< The min Y of the tpc
+      float m_maxY;           ///< The max Y of the tpc
+      float m_minZ;           ///< The min Z of the tpc
+      float m_maxZ;           ///< The max Z of the tpc
+      double m_centralMinX;   ///< The min X of the central half of the drift coordinate range
+      double m_centralMaxX;   ///< The max X of the central half of the drift coordinate range
+    };
+
+    /**
+     *  @brief  Group the TPCs of a cryostat into drift volumes, sweeping over the TPCs in order of
+     *          their central X range and matching those that overlap each seed TPC
+     *
+     *  @param  tpcSummaries the input tpc summaries, in geometry order
+     *  @param  tpcGroups to receive, for each drift volume, the index of its seed tpc followed by those of its other tpcs
+     */
+    static void GroupTpcs(const std::vector<TpcSummary>& tpcSummaries,
+                          std::vector<std::vector<unsigned int>>& tpcGroups);
+
+    /**
+     *  @brief  Find the pairs of drift volumes that may be separated by a detector gap, sweeping
+     *          over the volumes in order of their min X and stopping once they are too far apart
+     *
+     *  @param  driftVolumeList the input drift volume list
+     *  @param  maxGapX the largest gap in X that the detector type can accept
+     *  @param  gapCandidates to receive, for each drift volume, the later volumes in the list to check
+     */
+    static void FindDetectorGapCandidates(const LArDriftVolumeList& driftVolumeList,
+                                          const float maxGapX,
+                                          std::vector<std::vector<unsigned int>>& gapCandidates);
+
   private:
+    /**
+     *  @brief  GlobalViewTable class, the global view of each view in each cryostat/tpc
+     */
+    class GlobalViewTable {
+    public:
+      /**
+       *  @brief  Constructor, tabulating the global views for every TPC in the geometry
+       */
+      GlobalViewTable();
+
+      /**
+       *  @brief  Get the global view, throwing for an unknown cryostat/tpc or view
+       *
+       *  @param  cstat the input cryostat
+       *  @param  tpc the input tpc
+       *  @param  hit_View the input view
+       */
+      geo::View_t GetGlobalView(const unsigned int cstat,
+                                const unsigned int tpc,
+                                const geo::View_t hit_View) const;
+
+      /**
+       *  @brief  Return whether U/V should be switched in global coordinate system for this cryostat/tpc
+       *
+       *  @param  cstat the input cryostat
+       *  @param  tpc the input tpc
+       */
+      bool ShouldSwitchUV(const unsigned int cstat, const unsigned int tpc) const;
+
+    private:
+      /**
+       *  @brief  Get the index of a cryostat/tpc in the table, throwing if it is unknown
+       *
+       *  @param  cstat the input cryostat
+       *  @param  tpc the input tpc
+       */
+      unsigned int GetTpcIndex(const unsigned int cstat, const unsigned int tpc) const;
+
+      static constexpr unsigned int m_nViews = geo::kUnknown + 1; ///< The number of views per TPC
+
+      std::vector<unsigned int> m_firstTpcIndex; ///< The index of the first TPC of each cryostat
+      std::vector<unsigned int> m_nTpcs;         ///< The number of TPCs in each cryostat
+      std::vector<bool> m_switchUV;              ///< Whether U/V are switched, for each TPC
+      std::vector<geo::View_t> m_globalViews;    ///< The global view of each view, for each TPC
+    };
+
+    /**
+     *  @brief  Get the global view table, built on first use
+     */
+    static const GlobalViewTable& GetGlobalViewTable();
+
     /**
      *  @brief  Generate a unique identifier for each TPC
      *
@@ -106,6 +239,22 @@ namespace lar_pandora {
      */
     static void LoadGeometry(LArDriftVolumeList& driftVolumeList, const bool useActiveBoundingBox);
 
+    /**
+     *  @brief  Create the daughter drift volume for a tpc
+     *
+     *  @param  cstat the input cryostat
+     *  @param  tpcSummary the input tpc summary
+     */
+    static LArDaughterDriftVolume MakeDaughterDriftVolume(const unsigned int cstat,
+                                                          const TpcSummary& tpcSummary);
+
+    /**
+     *  @brief  Get the min X of a drift volume
+     *
+     *  @param  driftVolume the input drift volume
+     */
+    static float GetMinX(const LArDriftVolume& driftVolume);
+
     /**
      *  @brief  This method will create one or more daughter volumes (these share a common drift orientation along the X-axis,
      *          have parallel or near-parallel wire angles, and similar wire pitches)
@@ -10,6 +10,8 @@
 #include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
 
 #include <map>
+#include <memory>
+#include <unordered_map>
 #include <vector>
 
 namespace lar_pandora {
@@ -312,7 +314,81 @@ namespace lar_pandora {
   };
 
   typedef std::vector<LArDriftVolume> LArDriftVolumeList;
-  typedef std::map<unsigned int, LArDriftVolume> LArDriftVolumeMap;
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  /**
+ *  @brief  drift volume map class, mapping each tpc to its position in a shared drift volume list
+ */
+  class LArDriftVolumeMap {
+  public:
+    /**
+     *  @brief  Indices class, the position of a tpc in the drift volume list
+     */
+    class Indices {
+    public:
+      /**
+       *  @brief  Constructor
+       *
+       *  @param  volumeIndex      index of the drift volume in the list
+       *  @param  daughterIndex    index of the tpc in the daughter list of the drift volume
+       */
+      Indices(const unsigned int volumeIndex, const unsigned int daughterIndex);
+
+      unsigned int m_volumeIndex;   ///< The index of the drift volume in the list
+      unsigned int m_daughterIndex; ///< The index of the tpc in the daughter list
+    };
+
+    typedef std::unordered_map<unsigned int, Indices> TpcIndicesMap;
+
+    /**
+     *  @brief  Default constructor, an empty map
+     */
+    LArDriftVolumeMap();
+
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  pDriftVolumeList the shared drift volume list
+     *  @param  tpcIndicesMap    the mapping from tpc unique ID to positions in the list
+     */
+    LArDriftVolumeMap(const std::shared_ptr<const LArDriftVolumeList>& pDriftVolumeList,
+                      const TpcIndicesMap& tpcIndicesMap);
+
+    /**
+     *  @brief  Return whether the map is empty
+     */
+    bool empty() const;
+
+    /**
+     *  @brief  Return the position of a tpc in the drift volume list, or null if it is unknown
+     *
+     *  @param  tpcID            the tpc unique ID
+     */
+    const Indices* GetIndices(const unsigned int tpcID) const;
+
+    /**
+     *  @brief  Return a drift volume in the list
+     *
+     *  @param  volumeIndex      index of the drift volume in the list
+     */
+    const LArDriftVolume& GetDriftVolume(const unsigned int volumeIndex) const;
+
+    /**
+     *  @brief  Return the shared drift volume list
+     */
+    const LArDriftVolumeList& GetDriftVolumeList() const;
+
+    /**
+     *  @brief  Return the mapping from tpc unique ID to positions in the list
+     */
+    const TpcIndicesMap& GetTpcIndicesMap() const;
+
+  private:
+    std::shared_ptr<const LArDriftVolumeList> m_pDriftVolumeList; ///< The drift volume list
+    TpcIndicesMap m_tpcIndicesMap;                                ///< The tpc positions in the list
+  };
 
   //------------------------------------------------------------------------------------------------------------------------------------------
   //------------------------------------------------------------------------------------------------------------------------------------------
@@ -565,6 +641,66 @@ namespace lar_pandora {
     return m_tpcVolumeList;
   }
 
+  //------------------------------------------------------------------------------------------------------------------------------------------
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  inline LArDriftVolumeMap::Indices::Indices(const unsigned int volumeIndex,
+                                             const unsigned int daughterIndex)
+    : m_volumeIndex(volumeIndex), m_daughterIndex(daughterIndex)
+  {}
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  inline LArDriftVolumeMap::LArDriftVolumeMap()
+    : m_pDriftVolumeList(std::make_shared<const LArDriftVolumeList>())
+  {}
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  inline LArDriftVolumeMap::LArDriftVolumeMap(
+    const std::shared_ptr<const LArDriftVolumeList>& pDriftVolumeList,
+    const TpcIndicesMap& tpcIndicesMap)
+    : m_pDriftVolumeList(pDriftVolumeList), m_tpcIndicesMap(tpcIndicesMap)
+  {}
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  inline bool LArDriftVolumeMap::empty() const
+  {
+    return m_tpcIndicesMap.empty();
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  inline const LArDriftVolumeMap::Indices* LArDriftVolumeMap::GetIndices(
+    const unsigned int tpcID) const
+  {
+    const TpcIndicesMap::const_iterator iter(m_tpcIndicesMap.find(tpcID));
+    return ((m_tpcIndicesMap.end() == iter) ? nullptr : &iter->second);
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  inline const LArDriftVolume& LArDriftVolumeMap::GetDriftVolume(
+    const unsigned int volumeIndex) const
+  {
+    return m_pDriftVolumeList->at(volumeIndex);
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  inline const LArDriftVolumeList& LArDriftVolumeMap::GetDriftVolumeList() const
+  {
+    return *m_pDriftVolumeList;
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  inline const LArDriftVolumeMap::TpcIndicesMap& LArDriftVolumeMap::GetTpcIndicesMap() const
+  {
+    return m_tpcIndicesMap;
+  }
+
 } // namespace lar_pandora
 
 #endif // #ifndef LAR_PANDORA_GEOMETRY_H
@@ -39,6 +39,7 @@
 #include "Pandora/PandoraInternal.h"
 #include "Pandora/PdgTable.h"
 
+#include <algorithm>
 #include <iostream>
 #include <limits>
 
@@ -904,13 +905,21 @@ namespace lar_pandora {
       simChannelMap.insert(SimChannelMap::value_type(simChannel->Channel(), simChannel));
     }
 
-    for (HitVector::const_iterator iter = hitVector.begin(), iterEnd = hitVector.end();
-         iter != iterEnd;
-         ++iter) {
-      const art::Ptr<recob::Hit> hit = *iter;
+    // Order the hit TDC windows by channel and start TDC, so that each SimChannel's deposits are swept
+    // forwards once rather than searched again for every hit
+    struct HitTDCWindow {
+      raw::ChannelID_t channel;
+      unsigned int startTDC;
+      unsigned int endTDC;
+      art::Ptr<recob::Hit> hit;
+    };
+
+    std::vector<HitTDCWindow> hitWindows;
+    hitWindows.reserve(hitVector.size());
 
-      SimChannelMap::const_iterator sIter = simChannelMap.find(hit->Channel());
-      if (simChannelMap.end() == sIter) continue; // Hit has no truth information [continue]
+    for (const art::Ptr<recob::Hit>& hit : hitVector) {
+      if (simChannelMap.end() == simChannelMap.find(hit->Channel()))
+        continue; // Hit has no truth information [continue]
 
       // ATTN: Need to convert TDCtick (integer) to TDC (unsigned integer) before passing to simChannel
       const raw::TDCtick_t start_tick(clock_data.TPCTick2TDC(hit->PeakTimeMinusRMS()));
@@ -920,15 +929,114 @@ namespace lar_pandora {
 
       if (start_tdc > end_tdc) continue; // Hit undershoots the readout window [continue]
 
-      const art::Ptr<sim::SimChannel> simChannel = sIter->second;
-      const TrackIDEVector trackCollection(simChannel->TrackIDEs(start_tdc, end_tdc));
+      hitWindows.push_back({hit->Channel(), start_tdc, end_tdc, hit});
+    }
 
-      if (trackCollection.empty()) continue; // Hit has no truth information [continue]
+    std::stable_sort(hitWindows.begin(),
+                     hitWindows.end(),
+                     [](const HitTDCWindow& lhs, const HitTDCWindow& rhs) {
+                       if (lhs.channel != rhs.channel) return lhs.channel < rhs.channel;
+                       return lhs.startTDC < rhs.startTDC;
+                     });
 
-      for (unsigned int iTrack = 0, iTrackEnd = trackCollection.size(); iTrack < iTrackEnd;
-           ++iTrack) {
-        const sim::TrackIDE trackIDE = trackCollection.at(iTrack);
-        hitsToTrackIDEs[hit].push_back(trackIDE);
+    std::vector<std::pair<unsigned int, unsigned int>> tdcWindows;
+    std::vector<TrackIDEVector> trackIDEsPerWindow;
+
+    for (auto wIter = hitWindows.begin(), wIterEnd = hitWindows.end(); wIter != wIterEnd;) {
+      const raw::ChannelID_t channel(wIter->channel);
+      const auto wIterChannelEnd(
+        std::find_if(wIter, wIterEnd, [channel](const HitTDCWindow& hitWindow) {
+          return hitWindow.channel != channel;
+        }));
+
+      tdcWindows.clear();
+      for (auto iter = wIter; iter != wIterChannelEnd; ++iter)
+        tdcWindows.emplace_back(iter->startTDC, iter->endTDC);
+
+      LArPandoraHelper::CollectTrackIDEs(
+        *simChannelMap.at(channel), tdcWindows, trackIDEsPerWindow);
+
+      for (const TrackIDEVector& trackCollection : trackIDEsPerWindow) {
+        if (!trackCollection.empty()) {
+          TrackIDEVector& hitTrackIDEs(hitsToTrackIDEs[wIter->hit]);
+          hitTrackIDEs.insert(hitTrackIDEs.end(), trackCollection.begin(), trackCollection.end());
+        }
+
+        ++wIter;
+      }
+    }
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  void LArPandoraHelper::CollectTrackIDEs(
+    const sim::SimChannel& simChannel,
+    const std::vector<std::pair<unsigned int, unsigned int>>& tdcWindows,
+    std::vector<TrackIDEVector>& trackIDEsPerWindow)
+  {
+    trackIDEsPerWindow.clear();
+    trackIDEsPerWindow.resize(tdcWindows.size());
+
+    const auto& tdcIDEs(simChannel.TDCIDEMap());
+    auto firstTDCIter(tdcIDEs.begin());
+    unsigned int previousStartTDC(0);
+
+    // ATTN: The deposits are summed exactly as in SimChannel::TrackIDsAndEnergies and SimChannel::TrackIDEs: per track
+    // ID in double precision, stored as float, then normalised by a double precision total over ascending track IDs
+    std::map<int, sim::IDE> trackIDToIDE;
+
+    for (unsigned int iWindow = 0; iWindow < tdcWindows.size(); ++iWindow) {
+      const unsigned int startTDC(tdcWindows.at(iWindow).first);
+      const unsigned int endTDC(tdcWindows.at(iWindow).second);
+
+      if (startTDC > endTDC) continue; // Window is empty [continue]
+
+      // The first deposit only moves forwards while start TDCs do not decrease
+      if (startTDC < previousStartTDC) firstTDCIter = tdcIDEs.begin();
+
+      previousStartTDC = startTDC;
+
+      while ((tdcIDEs.end() != firstTDCIter) && (firstTDCIter->first < startTDC))
+        ++firstTDCIter;
+
+      trackIDToIDE.clear();
+
+      for (auto tdcIter = firstTDCIter; (tdcIDEs.end() != tdcIter) && (tdcIter->first <= endTDC);
+           ++tdcIter) {
+        for (const sim::IDE& ide : tdcIter->second) {
+          const auto ideIter(trackIDToIDE.find(ide.trackID));
+
+          if (trackIDToIDE.end() == ideIter) {
+            trackIDToIDE.emplace(ide.trackID, ide);
+            continue;
+          }
+
+          sim::IDE& trackIDE(ideIter->second);
+          const double numElectrons(static_cast<double>(trackIDE.numElectrons) +
+                                    static_cast<double>(ide.numElectrons));
+          const double energy(static_cast<double>(trackIDE.energy) +
+                              static_cast<double>(ide.energy));
+          trackIDE.numElectrons = numElectrons;
+          trackIDE.energy = energy;
+        }
+      }
+
+      double totalEnergy(0.);
+      for (const auto& trackIDAndIDE : trackIDToIDE)
+        totalEnergy += trackIDAndIDE.second.energy;
+
+      if (totalEnergy < 1.e-5) totalEnergy = 1.;
+
+      TrackIDEVector& trackIDEs(trackIDEsPerWindow.at(iWindow));
+      trackIDEs.reserve(trackIDToIDE.size());
+
+      for (const auto& trackIDAndIDE : trackIDToIDE) {
+        sim::TrackIDE trackIDE;
+        trackIDE.trackID = trackIDAndIDE.first;
+        trackIDE.energyFrac = trackIDAndIDE.second.energy / totalEnergy;
+        trackIDE.energy = trackIDAndIDE.second.energy;
+        trackIDE.numElectrons = trackIDAndIDE.second.numElectrons;
+        trackIDEs.push_back(trackIDE);
       }
     }
   }
@@ -1462,6 +1570,106 @@ namespace lar_pandora {
   //------------------------------------------------------------------------------------------------------------------------------------------
   //------------------------------------------------------------------------------------------------------------------------------------------
 
+  LArPandoraHelper::TPCBoundingBoxTable::TPCBoundingBoxTable()
+  {
+    art::ServiceHandle<geo::Geometry const> theGeometry;
+
+    // ATTN Apply the tolerance as geo::BoxBoundedGeo::ContainsPosition does, with the wiggle used
+    // by geo::GeometryCore::FindTPCAtPosition, so that the same points are found to be contained
+    const double wiggle(1.0 + theGeometry->PositionWiggle());
+
+    m_detectorBounds = {std::numeric_limits<double>::max(),
+                        std::numeric_limits<double>::lowest(),
+                        std::numeric_limits<double>::max(),
+                        std::numeric_limits<double>::lowest(),
+                        std::numeric_limits<double>::max(),
+                        std::numeric_limits<double>::lowest()};
+
+    for (const geo::TPCGeo& tpc : theGeometry->Iterate<geo::TPCGeo>()) {
+      const Bounds bounds{(tpc.MinX() > 0.) ? tpc.MinX() / wiggle : tpc.MinX() * wiggle,
+                          (tpc.MaxX() < 0.) ? tpc.MaxX() / wiggle : tpc.MaxX() * wiggle,
+                          (tpc.MinY() > 0.) ? tpc.MinY() / wiggle : tpc.MinY() * wiggle,
+                          (tpc.MaxY() < 0.) ? tpc.MaxY() / wiggle : tpc.MaxY() * wiggle,
+                          (tpc.MinZ() > 0.) ? tpc.MinZ() / wiggle : tpc.MinZ() * wiggle,
+                          (tpc.MaxZ() < 0.) ? tpc.MaxZ() / wiggle : tpc.MaxZ() * wiggle};
+      m_tpcBounds.push_back(bounds);
+
+      for (unsigned int i = 0; i < 6; i += 2) {
+        m_detectorBounds[i] = std::min(m_detectorBounds[i], bounds[i]);
+        m_detectorBounds[i + 1] = std::max(m_detectorBounds[i + 1], bounds[i + 1]);
+      }
+    }
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  bool LArPandoraHelper::TPCBoundingBoxTable::IsContained(const double x,
+                                                          const double y,
+                                                          const double z,
+                                                          size_t& tpcIndex) const
+  {
+    if (!TPCBoundingBoxTable::IsWithinBounds(m_detectorBounds, x, y, z)) return false;
+
+    // Consecutive trajectory points usually lie in the same TPC, so test the previous one first
+    if ((tpcIndex < m_tpcBounds.size()) &&
+        TPCBoundingBoxTable::IsWithinBounds(m_tpcBounds[tpcIndex], x, y, z))
+      return true;
+
+    for (size_t i = 0; i < m_tpcBounds.size(); ++i) {
+      if (TPCBoundingBoxTable::IsWithinBounds(m_tpcBounds[i], x, y, z)) {
+        tpcIndex = i;
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  bool LArPandoraHelper::TPCBoundingBoxTable::GetStartAndEndPoints(
+    const simb::MCParticle& particle,
+    int& startT,
+    int& endT) const
+  {
+    const int numTrajectoryPoints(static_cast<int>(particle.NumberTrajectoryPoints()));
+    size_t tpcIndex(m_tpcBounds.size());
+
+    // Search inwards from either end, rather than testing every trajectory point
+    int firstT(0);
+    for (; firstT < numTrajectoryPoints; ++firstT) {
+      if (this->IsContained(
+            particle.Vx(firstT), particle.Vy(firstT), particle.Vz(firstT), tpcIndex))
+        break;
+    }
+
+    if (firstT == numTrajectoryPoints) return false;
+
+    int lastT(numTrajectoryPoints - 1);
+    for (; lastT > firstT; --lastT) {
+      if (this->IsContained(particle.Vx(lastT), particle.Vy(lastT), particle.Vz(lastT), tpcIndex))
+        break;
+    }
+
+    startT = firstT;
+    endT = lastT;
+    return true;
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
+  bool LArPandoraHelper::TPCBoundingBoxTable::IsWithinBounds(const Bounds& bounds,
+                                                             const double x,
+                                                             const double y,
+                                                             const double z)
+  {
+    return ((x >= bounds[0]) && (x <= bounds[1]) && (y >= bounds[2]) && (y <= bounds[3]) &&
+            (z >= bounds[4]) && (z <= bounds[5]));
+  }
+
+  //------------------------------------------------------------------------------------------------------------------------------------------
+  //------------------------------------------------------------------------------------------------------------------------------------------
+
   template void LArPandoraHelper::GetAssociatedHits(const art::Event&,
                                                     const std::string&,
                                                     const std::vector<art::Ptr<recob::Cluster>>&,
@@ -13,9 +13,11 @@ namespace art {
 
 #include "canvas/Persistency/Common/Ptr.h"
 
+#include <array>
 #include <map>
 #include <set>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace anab {
@@ -129,6 +131,54 @@ namespace lar_pandora {
       kAddDaughters = 2     // Absorb daughter particles into parent particles
     };
 
+    /**
+     *  @brief  TPCBoundingBoxTable class, the bounds of each TPC for fast containment tests
+     */
+    class TPCBoundingBoxTable {
+    public:
+      /**
+       *  @brief  Constructor, reading the TPC bounds from the geometry service
+       */
+      TPCBoundingBoxTable();
+
+      /**
+       *  @brief  Whether a position lies within any TPC, using the same tolerance as the geometry
+       *
+       *  @param  x the x coordinate
+       *  @param  y the y coordinate
+       *  @param  z the z coordinate
+       *  @param  tpcIndex the index of the TPC to test first, set to the containing TPC if found
+       *
+       *  @return boolean
+       */
+      bool IsContained(const double x, const double y, const double z, size_t& tpcIndex) const;
+
+      /**
+       *  @brief  Find the first and last trajectory points of a particle that lie within any TPC
+       *
+       *  @param  particle the true particle
+       *  @param  startT to receive the first trajectory point within a TPC
+       *  @param  endT to receive the last trajectory point within a TPC
+       *
+       *  @return whether any trajectory point lies within a TPC (if not, startT and endT are unset)
+       */
+      bool GetStartAndEndPoints(const simb::MCParticle& particle, int& startT, int& endT) const;
+
+    private:
+      typedef std::array<double, 6> Bounds; ///< Min and max x, then y, then z
+
+      /**
+       *  @brief  Whether a position lies within the given bounds
+       */
+      static bool IsWithinBounds(const Bounds& bounds,
+                                 const double x,
+                                 const double y,
+                                 const double z);
+
+      std::vector<Bounds> m_tpcBounds; ///< The bounds of each TPC, including the tolerance
+      Bounds m_detectorBounds;         ///< The bounds enclosing all of the TPCs
+    };
+
     /**
      *  @brief Collect the reconstructed wires from the ART event record
      *
@@ -489,6 +539,19 @@ namespace lar_pandora {
                                        const SimChannelVector& simChannelVector,
                                        HitsToTrackIDEs& hitsToTrackIDEs);
 
+    /**
+     *  @brief Collect the true energy deposits of a SimChannel in each of a set of TDC windows, sweeping the
+     *         deposits forwards rather than searching them again for each window
+     *
+     *  @param simChannel the input SimChannel
+     *  @param tdcWindows the input inclusive start and end TDCs of the windows, best ordered by start TDC
+     *  @param trackIDEsPerWindow the output true energy deposits of each window, as given by SimChannel::TrackIDEs
+     */
+    static void CollectTrackIDEs(
+      const sim::SimChannel& simChannel,
+      const std::vector<std::pair<unsigned int, unsigned int>>& tdcWindows,
+      std::vector<TrackIDEVector>& trackIDEsPerWindow);
+
     /**
      *  @brief Build mapping between Hits and MCParticles, starting from Hit/TrackIDE/MCParticle information
      *
@@ -0,0 +1,37 @@
+/**
+ *  @file  larpandora/LArPandoraInterface/LArPandoraHitCollectionToolFiltered.h
+ *
+ *  @brief Implement filtered hit collection tool (.h)
+ *
+ */
+
+#include "larpandora/LArPandoraInterface/LArPandoraHelper.h"
+#include "larpandora/LArPandoraInterface/LArPandoraHitCollectionTool.h"
+
+namespace lar_pandora {
+
+  /**
+ *  @brief  LArPandoraHitCollectionToolFiltered class
+ *
+ *  Collects the hits as the default tool does, then removes those below the integral and width
+ *  thresholds, those on channels flagged noisy by the channel status service and, optionally,
+ *  those outside a time window around the trigger. The number of hits removed by each criterion
+ *  is reported for every event.
+ */
+  class LArPandoraHitCollectionToolFiltered : public IHitCollectionTool {
+  public:
+    explicit LArPandoraHitCollectionToolFiltered(const fhicl::ParameterSet& pset);
+    void CollectHits(const art::Event& evt,
+                     const std::string& label,
+                     HitVector& hitVector) override;
+
+  private:
+    double m_minHitIntegral;    ///< The minimum hit integral
+    double m_minHitWidth;       ///< The minimum hit width (rms, in ticks)
+    bool m_removeNoisyChannels; ///< Whether to remove hits on channels flagged noisy
+    bool m_useTimeWindow;       ///< Whether to remove hits outside the time window
+    double m_timeWindowStart;   ///< The start of the time window (us, relative to the trigger)
+    double m_timeWindowEnd;     ///< The end of the time window (us, relative to the trigger)
+  };
+
+} // namespace lar_pandora
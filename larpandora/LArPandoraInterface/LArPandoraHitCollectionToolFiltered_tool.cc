@@ -0,0 +1,90 @@
+/**
+ *  @file  larpandora/LArPandoraInterface/LArPandoraHitCollectionToolFiltered_tool.cc
+ *
+ *  @brief Implement filtered hit collection tool (_tool.cc)
+ *
+ */
+
+#include "art/Utilities/ToolMacros.h"
+#include "cetlib_except/exception.h"
+#include "messagefacility/MessageLogger/MessageLogger.h"
+
+#include "lardata/DetectorInfoServices/DetectorClocksService.h"
+#include "lardataobj/RecoBase/Hit.h"
+#include "larevt/CalibrationDBI/Interface/ChannelStatusProvider.h"
+#include "larevt/CalibrationDBI/Interface/ChannelStatusService.h"
+
+#include "larpandora/LArPandoraInterface/LArPandoraHitCollectionToolFiltered.h"
+
+namespace lar_pandora {
+
+  LArPandoraHitCollectionToolFiltered::LArPandoraHitCollectionToolFiltered(
+    const fhicl::ParameterSet& pset)
+    : m_minHitIntegral(pset.get<double>("MinHitIntegral", 0.))
+    , m_minHitWidth(pset.get<double>("MinHitWidth", 0.))
+    , m_removeNoisyChannels(pset.get<bool>("RemoveNoisyChannels", true))
+    , m_useTimeWindow(pset.get<bool>("UseTimeWindow", false))
+    , m_timeWindowStart(pset.get<double>("TimeWindowStart", 0.))
+    , m_timeWindowEnd(pset.get<double>("TimeWindowEnd", 0.))
+  {
+    if (m_useTimeWindow && (m_timeWindowEnd < m_timeWindowStart))
+      throw cet::exception("LArPandora")
+        << "LArPandoraHitCollectionToolFiltered - time window end precedes its start ";
+  }
+
+  void LArPandoraHitCollectionToolFiltered::CollectHits(const art::Event& evt,
+                                                        const std::string& label,
+                                                        HitVector& hitVector)
+  {
+    HitVector inputHitVector;
+    LArPandoraHelper::CollectHits(evt, label, inputHitVector);
+
+    const lariov::ChannelStatusProvider* const pChannelStatus(
+      m_removeNoisyChannels ?
+        &art::ServiceHandle<lariov::ChannelStatusService const>()->GetProvider() :
+        nullptr);
+
+    detinfo::DetectorClocksData const clockData(
+      art::ServiceHandle<detinfo::DetectorClocksService const>()->DataFor(evt));
+
+    unsigned int nLowIntegral(0), nNarrow(0), nNoisyChannel(0), nOutOfTime(0);
+
+    for (const art::Ptr<recob::Hit>& hit : inputHitVector) {
+      if (hit->Integral() < m_minHitIntegral) {
+        ++nLowIntegral;
+        continue;
+      }
+
+      if (hit->RMS() < m_minHitWidth) {
+        ++nNarrow;
+        continue;
+      }
+
+      if (pChannelStatus && pChannelStatus->IsNoisy(hit->Channel())) {
+        ++nNoisyChannel;
+        continue;
+      }
+
+      if (m_useTimeWindow) {
+        const double hitTime(clockData.TPCTick2TrigTime(hit->PeakTime()));
+
+        if ((hitTime < m_timeWindowStart) || (hitTime > m_timeWindowEnd)) {
+          ++nOutOfTime;
+          continue;
+        }
+      }
+
+      hitVector.push_back(hit);
+    }
+
+    mf::LogInfo("LArPandora") << " LArPandoraHitCollectionToolFiltered - kept " << hitVector.size()
+                              << " of " << inputHitVector.size() << " hits, removed "
+                              << nLowIntegral << " below integral threshold, " << nNarrow
+                              << " below width threshold, " << nNoisyChannel
+                              << " on noisy channels, " << nOutOfTime << " outside time window "
+                              << std::endl;
+  }
+
+} // namespace lar_pandora
+
+DEFINE_ART_CLASS_TOOL(lar_pandora::LArPandoraHitCollectionToolFiltered)
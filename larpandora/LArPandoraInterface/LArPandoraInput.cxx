@@ -37,7 +37,10 @@
 
 #include "messagefacility/MessageLogger/MessageLogger.h"
 
+#include <algorithm>
 #include <limits>
+#include <numeric>
+#include <tuple>
 #include <utility>
 
 namespace lar_pandora {
@@ -61,16 +64,85 @@ namespace lar_pandora {
     auto const detProp = art::ServiceHandle<detinfo::DetectorPropertiesService const>()->DataFor(e);
     LArPandoraDetectorType* detType(detector_functions::GetDetectorType());
 
+    // Map the hits to Pandora views and transform their wire positions in a single batch
+    // ATTN Visit the hits grouped by drift volume, daughter volume, plane and wire, so that runs of hits share geometry lookups.
+    // The sort keys are read once per hit, and calo hits are still created in the input order below, so their ids are unaffected.
+    const unsigned int nHits(hitVector.size());
+    std::vector<geo::WireID> inputWireIDs;
+    std::vector<unsigned int> volumeIDs, daughterVolumeIDs;
+    std::vector<std::tuple<unsigned int, unsigned int, unsigned int, unsigned int>> sortKeys;
+
+    for (const art::Ptr<recob::Hit>& hit : hitVector) {
+      const geo::WireID hit_WireID(hit->WireID());
+      inputWireIDs.push_back(hit_WireID);
+      volumeIDs.push_back(
+        LArPandoraGeometry::GetVolumeID(driftVolumeMap, hit_WireID.Cryostat, hit_WireID.TPC));
+      daughterVolumeIDs.push_back(LArPandoraGeometry::GetDaughterVolumeID(
+        driftVolumeMap, hit_WireID.Cryostat, hit_WireID.TPC));
+      sortKeys.emplace_back(
+        volumeIDs.back(), daughterVolumeIDs.back(), hit_WireID.Plane, hit_WireID.Wire);
+    }
+
+    std::vector<unsigned int> hitIndices(nHits);
+    std::iota(hitIndices.begin(), hitIndices.end(), 0);
+    std::stable_sort(hitIndices.begin(),
+                     hitIndices.end(),
+                     [&sortKeys](const unsigned int lhs, const unsigned int rhs) {
+                       return (sortKeys.at(lhs) < sortKeys.at(rhs));
+                     });
+
+    std::vector<geo::WireID> hitWireIDs;
+    std::vector<geo::View_t> hitViews;
+    std::vector<double> wireYs, wireZs;
+
+    geo::WireID previousWireID;
+    geo::Point_t wireCenter;
+
+    for (const unsigned int hitIndex : hitIndices) {
+      const geo::WireID& hit_WireID(inputWireIDs.at(hitIndex));
+
+      // Get hit Y and Z coordinates, based on central position of wire
+      if (!previousWireID.isValid || !(hit_WireID == previousWireID)) {
+        wireCenter = theGeometry->Wire(hit_WireID).GetCenter();
+        previousWireID = hit_WireID;
+      }
+
+      hitWireIDs.push_back(hit_WireID);
+      hitViews.push_back(hitVector.at(hitIndex)->View());
+      wireYs.push_back(wireCenter.Y());
+      wireZs.push_back(wireCenter.Z());
+    }
+
+    std::vector<pandora::HitType> batchHitTypes;
+    std::vector<double> batchWirePositions;
+    std::vector<bool> batchIsTransformed;
+    detType->TransformWirePositions(hitWireIDs,
+                                    hitViews,
+                                    wireYs,
+                                    wireZs,
+                                    pPandora,
+                                    batchHitTypes,
+                                    batchWirePositions,
+                                    batchIsTransformed);
+
+    std::vector<pandora::HitType> hitTypes(nHits, pandora::HIT_CUSTOM);
+    std::vector<double> wirePositions(nHits, 0.);
+    std::vector<bool> isTransformed(nHits, false);
+
+    for (unsigned int iBatch = 0; iBatch < nHits; ++iBatch) {
+      hitTypes.at(hitIndices.at(iBatch)) = batchHitTypes.at(iBatch);
+      wirePositions.at(hitIndices.at(iBatch)) = batchWirePositions.at(iBatch);
+      isTransformed.at(hitIndices.at(iBatch)) = batchIsTransformed.at(iBatch);
+    }
+
     // Loop over ART hits
     int hitCounter(settings.m_hitCounterOffset);
 
     lar_content::LArCaloHitFactory caloHitFactory;
 
-    for (HitVector::const_iterator iter = hitVector.begin(), iterEnd = hitVector.end();
-         iter != iterEnd;
-         ++iter) {
-      const art::Ptr<recob::Hit> hit = *iter;
-      const geo::WireID hit_WireID(hit->WireID());
+    for (unsigned int iHit = 0; iHit < nHits; ++iHit) {
+      const art::Ptr<recob::Hit> hit = hitVector.at(iHit);
+      const geo::WireID& hit_WireID(inputWireIDs.at(iHit));
 
       // Get basic hit properties (view, time, charge)
       const geo::View_t hit_View(hit->View());
@@ -88,11 +160,6 @@ namespace lar_pandora {
                   detProp.ConvertTicksToX(
                     hit_TimeStart, hit_WireID.Plane, hit_WireID.TPC, hit_WireID.Cryostat)));
 
-      // Get hit Y and Z coordinates, based on central position of wire
-      auto const xyz = theGeometry->Wire(hit_WireID).GetCenter();
-      const double y0_cm(xyz.Y());
-      const double z0_cm(xyz.Z());
-
       // Get other hit properties here
       const double wire_pitch_cm(theGeometry->WirePitch(hit_View)); // cm
       const double mips(LArPandoraInput::GetMips(detProp, settings, hit_Charge, hit_View));
@@ -119,33 +186,20 @@ namespace lar_pandora {
         caloHitParameters.m_electromagneticEnergy = mips * settings.m_mips_to_gev;
         caloHitParameters.m_hadronicEnergy = mips * settings.m_mips_to_gev;
         caloHitParameters.m_pParentAddress = (void*)((intptr_t)(++hitCounter));
-        caloHitParameters.m_larTPCVolumeId =
-          LArPandoraGeometry::GetVolumeID(driftVolumeMap, hit_WireID.Cryostat, hit_WireID.TPC);
-        caloHitParameters.m_daughterVolumeId = LArPandoraGeometry::GetDaughterVolumeID(
-          driftVolumeMap, hit_WireID.Cryostat, hit_WireID.TPC);
-
-        if (hit_View == detType->TargetViewW(hit_WireID.TPC, hit_WireID.Cryostat)) {
-          caloHitParameters.m_hitType = pandora::TPC_VIEW_W;
-          const double wpos_cm(
-            pPandora->GetPlugins()->GetLArTransformationPlugin()->YZtoW(y0_cm, z0_cm));
-          caloHitParameters.m_positionVector = pandora::CartesianVector(xpos_cm, 0., wpos_cm);
-        }
-        else if (hit_View == detType->TargetViewU(hit_WireID.TPC, hit_WireID.Cryostat)) {
-          caloHitParameters.m_hitType = pandora::TPC_VIEW_U;
-          const double upos_cm(
-            pPandora->GetPlugins()->GetLArTransformationPlugin()->YZtoU(y0_cm, z0_cm));
-          caloHitParameters.m_positionVector = pandora::CartesianVector(xpos_cm, 0., upos_cm);
-        }
-        else if (hit_View == detType->TargetViewV(hit_WireID.TPC, hit_WireID.Cryostat)) {
-          caloHitParameters.m_hitType = pandora::TPC_VIEW_V;
-          const double vpos_cm(
-            pPandora->GetPlugins()->GetLArTransformationPlugin()->YZtoV(y0_cm, z0_cm));
-          caloHitParameters.m_positionVector = pandora::CartesianVector(xpos_cm, 0., vpos_cm);
-        }
-        else {
+        caloHitParameters.m_larTPCVolumeId = volumeIDs.at(iHit);
+        caloHitParameters.m_daughterVolumeId = daughterVolumeIDs.at(iHit);
+
+        // ATTN A hit whose wire position could not be transformed is omitted, as for any other invalid parameter
+        if (!isTransformed.at(iHit))
+          throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
+
+        if (pandora::HIT_CUSTOM == hitTypes.at(iHit))
           throw cet::exception("LArPandora")
             << "CreatePandoraHits2D - this wire view not recognised (View=" << hit_View << ") ";
-        }
+
+        caloHitParameters.m_hitType = hitTypes.at(iHit);
+        caloHitParameters.m_positionVector =
+          pandora::CartesianVector(xpos_cm, 0., wirePositions.at(iHit));
       }
       catch (const pandora::StatusCodeException&) {
         mf::LogWarning("LArPandora")
@@ -252,11 +306,11 @@ namespace lar_pandora {
 
     const pandora::Pandora* pPandora(settings.m_pPrimaryPandora);
 
-    for (const LArDetectorGap& gap : listOfGaps) {
-      PandoraApi::Geometry::LineGap::Parameters parameters;
+    LineGapParametersList parametersList;
 
+    for (const LArDetectorGap& gap : listOfGaps) {
       try {
-        parameters = detType->CreateLineGapParametersFromDetectorGaps(gap);
+        parametersList.push_back(detType->CreateLineGapParametersFromDetectorGaps(gap));
       }
       catch (const pandora::StatusCodeException&) {
         mf::LogWarning("LArPandora")
@@ -265,6 +319,12 @@ namespace lar_pandora {
           << std::endl;
         continue;
       }
+    }
+
+    // Hand Pandora fewer, larger gaps where adjacent or overlapping gaps can be merged exactly
+    detector_functions::CoalesceLineGaps(parametersList);
+
+    for (const PandoraApi::Geometry::LineGap::Parameters& parameters : parametersList) {
       try {
         PANDORA_THROW_RESULT_IF(pandora::STATUS_CODE_SUCCESS,
                                 !=,
@@ -298,6 +358,7 @@ namespace lar_pandora {
       art::ServiceHandle<lariov::ChannelStatusService const>()->GetProvider());
 
     LArPandoraDetectorType* detType(detector_functions::GetDetectorType());
+    LineGapParametersList parametersList;
 
     for (auto const& plane : theGeometry->Iterate<geo::PlaneGeo>()) {
       const float halfWirePitch(0.5f * theGeometry->WirePitch(plane.View()));
@@ -325,25 +386,16 @@ namespace lar_pandora {
         firstBadWire = -1;
         lastBadWire = -1;
 
-        PandoraApi::Geometry::LineGap::Parameters parameters;
-
         try {
-          float xFirst(-std::numeric_limits<float>::max());
-          float xLast(std::numeric_limits<float>::max());
-
           auto const [icstat, itpc] = std::make_pair(plane.ID().Cryostat, plane.ID().TPC);
-          const unsigned int volumeId(
-            LArPandoraGeometry::GetVolumeID(driftVolumeMap, icstat, itpc));
-          LArDriftVolumeMap::const_iterator volumeIter(driftVolumeMap.find(volumeId));
-
-          if (driftVolumeMap.end() != volumeIter) {
-            xFirst = volumeIter->second.GetCenterX() - 0.5f * volumeIter->second.GetWidthX();
-            xLast = volumeIter->second.GetCenterX() + 0.5f * volumeIter->second.GetWidthX();
-          }
+          const LArDriftVolume& driftVolume(
+            LArPandoraGeometry::GetDriftVolume(driftVolumeMap, icstat, itpc));
+          const float xFirst(driftVolume.GetCenterX() - 0.5f * driftVolume.GetWidthX());
+          const float xLast(driftVolume.GetCenterX() + 0.5f * driftVolume.GetWidthX());
 
           const geo::View_t iview = plane.View();
-          parameters = detType->CreateLineGapParametersFromReadoutGaps(
-            iview, itpc, icstat, firstXYZ, lastXYZ, halfWirePitch, xFirst, xLast, pPandora);
+          parametersList.push_back(detType->CreateLineGapParametersFromReadoutGaps(
+            iview, itpc, icstat, firstXYZ, lastXYZ, halfWirePitch, xFirst, xLast, pPandora));
         }
         catch (const pandora::StatusCodeException&) {
           mf::LogWarning("LArPandora")
@@ -352,18 +404,23 @@ namespace lar_pandora {
             << std::endl;
           continue;
         }
+      }
+    }
 
-        try {
-          PANDORA_THROW_RESULT_IF(pandora::STATUS_CODE_SUCCESS,
-                                  !=,
-                                  PandoraApi::Geometry::LineGap::Create(*pPandora, parameters));
-        }
-        catch (const pandora::StatusCodeException&) {
-          mf::LogWarning("LArPandora") << "CreatePandoraReadoutGaps - unable to create line "
-                                          "gap, insufficient or invalid information supplied "
-                                       << std::endl;
-          continue;
-        }
+    // Bad channel runs in neighbouring TPCs of a drift volume can touch or overlap, so merge them where exact
+    detector_functions::CoalesceLineGaps(parametersList);
+
+    for (const PandoraApi::Geometry::LineGap::Parameters& parameters : parametersList) {
+      try {
+        PANDORA_THROW_RESULT_IF(pandora::STATUS_CODE_SUCCESS,
+                                !=,
+                                PandoraApi::Geometry::LineGap::Create(*pPandora, parameters));
+      }
+      catch (const pandora::StatusCodeException&) {
+        mf::LogWarning("LArPandora") << "CreatePandoraReadoutGaps - unable to create line "
+                                        "gap, insufficient or invalid information supplied "
+                                     << std::endl;
+        continue;
       }
     }
   }
@@ -497,6 +554,9 @@ namespace lar_pandora {
     std::map<const simb::MCParticle, bool> primaryGeneratorMCParticleMap;
     LArPandoraInput::FindPrimaryParticles(generatorMCParticleVector, primaryGeneratorMCParticleMap);
 
+    // Tabulate the TPC bounds once, rather than asking the geometry about every trajectory point
+    const LArPandoraHelper::TPCBoundingBoxTable tpcBoundingBoxTable;
+
     for (MCParticleMap::const_iterator iterI = particleMap.begin(), iterEndI = particleMap.end();
          iterI != iterEndI;
          ++iterI) {
@@ -515,7 +575,7 @@ namespace lar_pandora {
 
       // Find start and end trajectory points
       int firstT(-1), lastT(-1);
-      LArPandoraInput::GetTrueStartAndEndPoints(settings, particle, firstT, lastT);
+      tpcBoundingBoxTable.GetStartAndEndPoints(*particle, firstT, lastT);
 
       if (firstT < 0 && lastT < 0) {
         firstT = 0;
@@ -714,58 +774,6 @@ namespace lar_pandora {
 
   //------------------------------------------------------------------------------------------------------------------------------------------
 
-  void LArPandoraInput::GetTrueStartAndEndPoints(const Settings& settings,
-                                                 const art::Ptr<simb::MCParticle>& particle,
-                                                 int& firstT,
-                                                 int& lastT)
-  {
-    art::ServiceHandle<geo::Geometry const> theGeometry;
-    firstT = -1;
-    lastT = -1;
-
-    for (auto const& tpcid : theGeometry->Iterate<geo::TPCID>()) {
-      int thisfirstT(-1), thislastT(-1);
-      LArPandoraInput::GetTrueStartAndEndPoints(tpcid, particle, thisfirstT, thislastT);
-
-      if (thisfirstT < 0) continue;
-
-      if (firstT < 0 || thisfirstT < firstT) firstT = thisfirstT;
-
-      if (lastT < 0 || thislastT > lastT) lastT = thislastT;
-    }
-  }
-
-  //------------------------------------------------------------------------------------------------------------------------------------------
-
-  void LArPandoraInput::GetTrueStartAndEndPoints(const geo::TPCID& ref_tpcid,
-                                                 const art::Ptr<simb::MCParticle>& particle,
-                                                 int& startT,
-                                                 int& endT)
-  {
-    art::ServiceHandle<geo::Geometry const> theGeometry;
-
-    bool foundStartPosition(false);
-    const int numTrajectoryPoints(static_cast<int>(particle->NumberTrajectoryPoints()));
-
-    for (int nt = 0; nt < numTrajectoryPoints; ++nt) {
-      const geo::Point_t pos{particle->Vx(nt), particle->Vy(nt), particle->Vz(nt)};
-      geo::TPCID tpcID = theGeometry->FindTPCAtPosition(pos);
-
-      if (!tpcID.isValid) continue;
-
-      if (tpcID != ref_tpcid) continue;
-
-      endT = nt;
-
-      if (!foundStartPosition) {
-        startT = endT;
-        foundStartPosition = true;
-      }
-    }
-  }
-
-  //------------------------------------------------------------------------------------------------------------------------------------------
-
   float LArPandoraInput::GetTrueX0(const art::Event& e,
                                    const art::Ptr<simb::MCParticle>& particle,
                                    const int nt)
@@ -59,7 +59,7 @@ namespace lar_pandora {
      *
      *  @param  evt art event being processed
      *  @param  settings the settings
-     *  @param  driftVolumeMap the mapping from volume id to drift volume
+     *  @param  driftVolumeMap the mapping from cryostat/tpc to drift volume
      *  @param  hits the input list of ART hits for this event
      *  @param  idToHitMap to receive the mapping from Pandora hit ID to ART hit
      */
@@ -93,7 +93,7 @@ namespace lar_pandora {
      *  @brief  Create pandora line gaps to cover any (continuous regions of) bad channels
      *
      *  @param  settings the settings
-     *  @param  driftVolumeMap the mapping from volume id to drift volume
+     *  @param  driftVolumeMap the mapping from cryostat/tpc to drift volume
      */
     static void CreatePandoraReadoutGaps(const Settings& settings,
                                          const LArDriftVolumeMap& driftVolumeMap);
@@ -142,33 +142,6 @@ namespace lar_pandora {
   private:
     typedef std::map<std::string, lar_content::MCProcess> MCProcessMap;
 
-    /**
-     *  @brief  Loop over MC trajectory points and identify start and end points within the detector
-     *
-     *  @param  settings the settings
-     *  @param  particle the true particle
-     *  @param  startT the first trajectory point in the detector
-     *  @param  endT the last trajectory point in the detector
-     */
-    static void GetTrueStartAndEndPoints(const Settings& settings,
-                                         const art::Ptr<simb::MCParticle>& particle,
-                                         int& startT,
-                                         int& endT);
-
-    /**
-     *  @brief  Loop over MC trajectory points and identify start and end points within a given cryostat and TPC
-     *
-     *  @param  cstat the cryostat
-     *  @param  tpc the TPC
-     *  @param  particle the true particle
-     *  @param  startT the first trajectory point in the detector
-     *  @param  endT the last trajectory point in the detector
-     */
-    static void GetTrueStartAndEndPoints(const geo::TPCID& ref_tpcid,
-                                         const art::Ptr<simb::MCParticle>& particle,
-                                         int& startT,
-                                         int& endT);
-
     /**
      *  @brief  Use detector and time services to get a true X offset for a given trajectory point
      *
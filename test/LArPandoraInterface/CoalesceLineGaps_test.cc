@@ -0,0 +1,134 @@
+/**
+ *  @file   test/LArPandoraInterface/CoalesceLineGaps_test.cc
+ *
+ *  @brief  Unit test of the line gap coalescing helper functions
+ *
+ *  $Log: $
+ */
+
+#define BOOST_TEST_MODULE (CoalesceLineGaps test)
+#include "boost/test/unit_test.hpp"
+
+#include "larpandora/LArPandoraInterface/Detectors/LArPandoraDetectorType.h"
+
+namespace {
+
+  PandoraApi::Geometry::LineGap::Parameters MakeGap(const pandora::LineGapType gapType,
+                                                    const float startX,
+                                                    const float endX,
+                                                    const float startZ,
+                                                    const float endZ)
+  {
+    PandoraApi::Geometry::LineGap::Parameters parameters;
+    parameters.m_lineGapType = gapType;
+    parameters.m_lineStartX = startX;
+    parameters.m_lineEndX = endX;
+    parameters.m_lineStartZ = startZ;
+    parameters.m_lineEndZ = endZ;
+    return parameters;
+  }
+
+  void CheckGap(const PandoraApi::Geometry::LineGap::Parameters& parameters,
+                const pandora::LineGapType gapType,
+                const float startX,
+                const float endX,
+                const float startZ,
+                const float endZ)
+  {
+    BOOST_TEST(parameters.m_lineGapType.Get() == gapType);
+    BOOST_TEST(parameters.m_lineStartX.Get() == startX);
+    BOOST_TEST(parameters.m_lineEndX.Get() == endX);
+    BOOST_TEST(parameters.m_lineStartZ.Get() == startZ);
+    BOOST_TEST(parameters.m_lineEndZ.Get() == endZ);
+  }
+
+} // namespace
+
+using namespace lar_pandora;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(TouchingGaps)
+{
+  LineGapParametersList parametersList;
+  parametersList.push_back(MakeGap(pandora::TPC_WIRE_GAP_VIEW_U, 0.f, 10.f, 5.f, 8.f));
+  parametersList.push_back(MakeGap(pandora::TPC_WIRE_GAP_VIEW_U, 0.f, 10.f, 0.f, 5.f));
+
+  BOOST_TEST(detector_functions::CoalesceLineGapsOnce(parametersList, true));
+  BOOST_TEST_REQUIRE(parametersList.size() == 1u);
+  CheckGap(parametersList.front(), pandora::TPC_WIRE_GAP_VIEW_U, 0.f, 10.f, 0.f, 8.f);
+
+  // Touching in X, along a shared Z range
+  parametersList.clear();
+  parametersList.push_back(MakeGap(pandora::TPC_DRIFT_GAP, 0.f, 2.f, -1.f, 1.f));
+  parametersList.push_back(MakeGap(pandora::TPC_DRIFT_GAP, 2.f, 3.f, -1.f, 1.f));
+
+  BOOST_TEST(!detector_functions::CoalesceLineGapsOnce(parametersList, true));
+  BOOST_TEST_REQUIRE(parametersList.size() == 2u);
+  BOOST_TEST(detector_functions::CoalesceLineGapsOnce(parametersList, false));
+  BOOST_TEST_REQUIRE(parametersList.size() == 1u);
+  CheckGap(parametersList.front(), pandora::TPC_DRIFT_GAP, 0.f, 3.f, -1.f, 1.f);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(OverlappingGaps)
+{
+  LineGapParametersList parametersList;
+  parametersList.push_back(MakeGap(pandora::TPC_WIRE_GAP_VIEW_V, 0.f, 10.f, 4.f, 9.f));
+  parametersList.push_back(MakeGap(pandora::TPC_WIRE_GAP_VIEW_V, 0.f, 10.f, 0.f, 5.f));
+  parametersList.push_back(MakeGap(pandora::TPC_WIRE_GAP_VIEW_V, 0.f, 10.f, 1.f, 2.f));
+
+  BOOST_TEST(detector_functions::CoalesceLineGapsOnce(parametersList, true));
+  BOOST_TEST_REQUIRE(parametersList.size() == 1u);
+  CheckGap(parametersList.front(), pandora::TPC_WIRE_GAP_VIEW_V, 0.f, 10.f, 0.f, 9.f);
+  BOOST_TEST(!detector_functions::CoalesceLineGapsOnce(parametersList, true));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(DisjointGaps)
+{
+  // Gaps with a gap between them, a different type or a different fixed range must not be merged
+  LineGapParametersList parametersList;
+  parametersList.push_back(MakeGap(pandora::TPC_WIRE_GAP_VIEW_W, 0.f, 10.f, 0.f, 5.f));
+  parametersList.push_back(MakeGap(pandora::TPC_WIRE_GAP_VIEW_W, 0.f, 10.f, 6.f, 8.f));
+  parametersList.push_back(MakeGap(pandora::TPC_WIRE_GAP_VIEW_U, 0.f, 10.f, 5.f, 6.f));
+  parametersList.push_back(MakeGap(pandora::TPC_WIRE_GAP_VIEW_W, 0.f, 11.f, 5.f, 6.f));
+
+  detector_functions::CoalesceLineGaps(parametersList);
+  BOOST_TEST(parametersList.size() == 4u);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(ReversedGaps)
+{
+  // Reversed gaps pass through untouched, even where their ranges would touch a regular gap
+  LineGapParametersList parametersList;
+  parametersList.push_back(MakeGap(pandora::TPC_WIRE_GAP_VIEW_U, 0.f, 10.f, 8.f, 5.f));
+  parametersList.push_back(MakeGap(pandora::TPC_WIRE_GAP_VIEW_U, 0.f, 10.f, 0.f, 5.f));
+  parametersList.push_back(MakeGap(pandora::TPC_WIRE_GAP_VIEW_U, 10.f, 0.f, 0.f, 5.f));
+
+  BOOST_TEST(!detector_functions::CoalesceLineGapsOnce(parametersList, true));
+  BOOST_TEST(!detector_functions::CoalesceLineGapsOnce(parametersList, false));
+  BOOST_TEST_REQUIRE(parametersList.size() == 3u);
+  CheckGap(parametersList.at(0), pandora::TPC_WIRE_GAP_VIEW_U, 0.f, 10.f, 0.f, 5.f);
+  CheckGap(parametersList.at(1), pandora::TPC_WIRE_GAP_VIEW_U, 0.f, 10.f, 8.f, 5.f);
+  CheckGap(parametersList.at(2), pandora::TPC_WIRE_GAP_VIEW_U, 10.f, 0.f, 0.f, 5.f);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(AlternatingMerges)
+{
+  // Merging along Z yields two gaps sharing a Z range, which can then be merged along X
+  LineGapParametersList parametersList;
+  parametersList.push_back(MakeGap(pandora::TPC_DRIFT_GAP, 0.f, 1.f, 0.f, 2.f));
+  parametersList.push_back(MakeGap(pandora::TPC_DRIFT_GAP, 0.f, 1.f, 2.f, 4.f));
+  parametersList.push_back(MakeGap(pandora::TPC_DRIFT_GAP, 1.f, 3.f, 0.f, 4.f));
+
+  detector_functions::CoalesceLineGaps(parametersList);
+  BOOST_TEST_REQUIRE(parametersList.size() == 1u);
+  CheckGap(parametersList.front(), pandora::TPC_DRIFT_GAP, 0.f, 3.f, 0.f, 4.f);
+}
@@ -0,0 +1,156 @@
+/**
+ *  @file   test/LArPandoraInterface/CollectTrackIDEs_test.cc
+ *
+ *  @brief  Unit test of the SimChannel sweep used to match hits to true energy deposits
+ *
+ *  $Log: $
+ */
+
+#define BOOST_TEST_MODULE (CollectTrackIDEs test)
+#include "boost/test/unit_test.hpp"
+
+#include "larpandora/LArPandoraInterface/LArPandoraHelper.h"
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+
+  typedef std::vector<std::pair<unsigned int, unsigned int>> TDCWindowList;
+
+  void AddDeposit(sim::SimChannel& simChannel,
+                  const int trackID,
+                  const unsigned int tdc,
+                  const double numElectrons,
+                  const double energy)
+  {
+    const double xyz[3] = {0.1 * tdc, -0.2 * tdc, 0.3 * tdc};
+    simChannel.AddIonizationElectrons(trackID, tdc, numElectrons, xyz, energy);
+  }
+
+  /**
+   *  @brief  Check that the sweep gives, for every window, exactly what SimChannel::TrackIDEs gives
+   */
+  void CheckAgainstTrackIDEs(const sim::SimChannel& simChannel, const TDCWindowList& tdcWindows)
+  {
+    std::vector<lar_pandora::TrackIDEVector> trackIDEsPerWindow;
+    lar_pandora::LArPandoraHelper::CollectTrackIDEs(simChannel, tdcWindows, trackIDEsPerWindow);
+    BOOST_TEST_REQUIRE(trackIDEsPerWindow.size() == tdcWindows.size());
+
+    for (unsigned int iWindow = 0; iWindow < tdcWindows.size(); ++iWindow) {
+      const unsigned int startTDC(tdcWindows.at(iWindow).first);
+      const unsigned int endTDC(tdcWindows.at(iWindow).second);
+      const lar_pandora::TrackIDEVector& trackIDEs(trackIDEsPerWindow.at(iWindow));
+
+      if (startTDC > endTDC) {
+        BOOST_TEST(trackIDEs.empty());
+        continue;
+      }
+
+      const lar_pandora::TrackIDEVector expectedTrackIDEs(simChannel.TrackIDEs(startTDC, endTDC));
+      BOOST_TEST_REQUIRE(trackIDEs.size() == expectedTrackIDEs.size());
+
+      for (unsigned int iTrack = 0; iTrack < trackIDEs.size(); ++iTrack) {
+        BOOST_TEST(trackIDEs.at(iTrack).trackID == expectedTrackIDEs.at(iTrack).trackID);
+        BOOST_TEST(trackIDEs.at(iTrack).energyFrac == expectedTrackIDEs.at(iTrack).energyFrac);
+        BOOST_TEST(trackIDEs.at(iTrack).energy == expectedTrackIDEs.at(iTrack).energy);
+        BOOST_TEST(trackIDEs.at(iTrack).numElectrons == expectedTrackIDEs.at(iTrack).numElectrons);
+      }
+    }
+  }
+
+} // namespace
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(EmptyChannel)
+{
+  const sim::SimChannel simChannel(7u);
+  CheckAgainstTrackIDEs(simChannel, {{0u, 10u}, {5u, 5u}, {20u, 10u}});
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(OrderedWindows)
+{
+  sim::SimChannel simChannel(7u);
+  AddDeposit(simChannel, 1, 10u, 100., 0.5);
+  AddDeposit(simChannel, 2, 10u, 50., 0.25);
+  AddDeposit(simChannel, 1, 11u, 120., 0.75);
+  AddDeposit(simChannel, -3, 12u, 10., 0.125);
+  AddDeposit(simChannel, 2, 20u, 80., 1.5);
+
+  // Disjoint, touching, overlapping and nested windows, plus windows before, between and after the deposits
+  CheckAgainstTrackIDEs(simChannel,
+                        {{0u, 5u},
+                         {0u, 10u},
+                         {10u, 10u},
+                         {10u, 12u},
+                         {11u, 20u},
+                         {12u, 12u},
+                         {13u, 19u},
+                         {15u, 30u},
+                         {21u, 40u}});
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(UnorderedWindows)
+{
+  sim::SimChannel simChannel(7u);
+  AddDeposit(simChannel, 4, 3u, 10., 0.1);
+  AddDeposit(simChannel, 5, 8u, 20., 0.2);
+  AddDeposit(simChannel, 4, 9u, 30., 0.3);
+
+  // Start TDCs that decrease restart the sweep, and reversed windows are empty
+  CheckAgainstTrackIDEs(simChannel, {{8u, 9u}, {0u, 3u}, {9u, 8u}, {3u, 9u}, {0u, 100u}});
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(NegligibleEnergy)
+{
+  // The energy fractions are not normalised when the summed energy is negligible
+  sim::SimChannel simChannel(7u);
+  AddDeposit(simChannel, 1, 5u, 1., 1.e-7);
+  AddDeposit(simChannel, 2, 5u, 1., 2.e-7);
+  CheckAgainstTrackIDEs(simChannel, {{0u, 10u}, {5u, 5u}});
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(RandomDeposits)
+{
+  std::mt19937 generator(20231019u);
+  std::uniform_int_distribution<unsigned int> tdcDistribution(0u, 400u);
+  std::uniform_int_distribution<int> trackDistribution(-5, 12);
+  std::uniform_real_distribution<double> energyDistribution(1.e-3, 5.);
+  std::uniform_real_distribution<double> electronsDistribution(1., 1.e4);
+  std::uniform_int_distribution<unsigned int> widthDistribution(0u, 40u);
+
+  for (unsigned int iChannel = 0; iChannel < 20u; ++iChannel) {
+    sim::SimChannel simChannel(iChannel);
+
+    for (unsigned int iDeposit = 0; iDeposit < 500u; ++iDeposit) {
+      const int trackID(trackDistribution(generator));
+      AddDeposit(simChannel,
+                 (0 == trackID) ? 1 : trackID,
+                 tdcDistribution(generator),
+                 electronsDistribution(generator),
+                 energyDistribution(generator));
+    }
+
+    TDCWindowList tdcWindows;
+    for (unsigned int iWindow = 0; iWindow < 200u; ++iWindow) {
+      const unsigned int startTDC(tdcDistribution(generator));
+      tdcWindows.emplace_back(startTDC, startTDC + widthDistribution(generator));
+    }
+
+    // Both the ordered windows, as swept by BuildMCParticleHitMaps, and the unordered ones
+    CheckAgainstTrackIDEs(simChannel, tdcWindows);
+    std::stable_sort(tdcWindows.begin(), tdcWindows.end());
+    CheckAgainstTrackIDEs(simChannel, tdcWindows);
+  }
+}
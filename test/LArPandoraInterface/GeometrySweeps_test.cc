@@ -0,0 +1,305 @@
+/**
+ *  @file   test/LArPandoraInterface/GeometrySweeps_test.cc
+ *
+ *  @brief  Unit test of the sweeps used to group TPCs into drift volumes and to find detector gaps
+ *
+ *  $Log: $
+ */
+
+#define BOOST_TEST_MODULE (GeometrySweeps test)
+#include "boost/test/unit_test.hpp"
+
+#include "larpandora/LArPandoraInterface/LArPandoraGeometry.h"
+#include "larpandora/LArPandoraInterface/LArPandoraGeometryComponents.h"
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace lar_pandora;
+
+namespace {
+
+  typedef std::vector<std::pair<unsigned int, unsigned int>> VolumePairList;
+  typedef std::vector<std::vector<unsigned int>> IndexGroupList;
+
+  LArDriftVolume MakeDriftVolume(const unsigned int volumeID,
+                                 const float centerX,
+                                 const float centerY,
+                                 const float centerZ,
+                                 const float widthX,
+                                 const float widthY,
+                                 const float widthZ)
+  {
+    return LArDriftVolume(volumeID,
+                          true,
+                          0.3f,
+                          0.3f,
+                          0.3f,
+                          0.6f,
+                          -0.6f,
+                          0.f,
+                          centerX,
+                          centerY,
+                          centerZ,
+                          widthX,
+                          widthY,
+                          widthZ,
+                          1.f,
+                          LArDaughterDriftVolumeList());
+  }
+
+  /**
+   *  @brief  Get the gap in X between two drift volumes, as in LoadDetectorGaps
+   */
+  float GetGapX(const LArDriftVolume& driftVolume1, const LArDriftVolume& driftVolume2)
+  {
+    const float deltaX(std::fabs(driftVolume1.GetCenterX() - driftVolume2.GetCenterX()));
+    const float widthX(0.5f * (driftVolume1.GetWidthX() + driftVolume2.GetWidthX()));
+    return (deltaX - widthX);
+  }
+
+  /**
+   *  @brief  Check the sweep candidates against an all-pairs loop: every pair whose gap in X is within the bound must be
+   *          visited in the all-pairs order, so that a CheckDetectorGapSize respecting the bound finds the same gaps
+   */
+  void CheckDetectorGapCandidates(const LArDriftVolumeList& driftVolumeList, const float maxGapX)
+  {
+    const unsigned int nVolumes(driftVolumeList.size());
+
+    VolumePairList expectedPairs;
+    for (unsigned int index1 = 0; index1 < nVolumes; ++index1) {
+      for (unsigned int index2 = index1 + 1; index2 < nVolumes; ++index2) {
+        if (GetGapX(driftVolumeList.at(index1), driftVolumeList.at(index2)) <= maxGapX)
+          expectedPairs.emplace_back(index1, index2);
+      }
+    }
+
+    IndexGroupList gapCandidates;
+    LArPandoraGeometry::FindDetectorGapCandidates(driftVolumeList, maxGapX, gapCandidates);
+    BOOST_TEST_REQUIRE(gapCandidates.size() == nVolumes);
+
+    VolumePairList pairs;
+    unsigned int nCandidates(0);
+    for (unsigned int index1 = 0; index1 < nVolumes; ++index1) {
+      for (const unsigned int index2 : gapCandidates.at(index1)) {
+        BOOST_TEST_REQUIRE(index2 > index1);
+        BOOST_TEST_REQUIRE(index2 < nVolumes);
+        ++nCandidates;
+
+        // The sweep may keep candidates within its tolerance of the bound, but no further
+        const float gapX(GetGapX(driftVolumeList.at(index1), driftVolumeList.at(index2)));
+        BOOST_TEST(gapX <= maxGapX + 1.01f);
+
+        if (gapX <= maxGapX) pairs.emplace_back(index1, index2);
+      }
+    }
+
+    BOOST_TEST((pairs == expectedPairs));
+
+    if (maxGapX >= std::numeric_limits<float>::max())
+      BOOST_TEST(nCandidates == nVolumes * (nVolumes - 1) / 2);
+  }
+
+  /**
+   *  @brief  Check the sweep for the MaxDetectorGapX of each detector type
+   */
+  void CheckDetectorGapCandidates(const LArDriftVolumeList& driftVolumeList)
+  {
+    // ATTN The detector types hold a geometry service handle, so their bounds are listed here rather than queried
+    const float maxDisplacement(LArDetectorGap::GetMaxGapSize());
+
+    // LArPandoraDetectorType default and ProtoDUNEDualPhase: unbounded
+    CheckDetectorGapCandidates(driftVolumeList, std::numeric_limits<float>::max());
+
+    // VintageLArTPCThreeView, ICARUS and DUNEFarDetVDThreeView: the max displacement
+    CheckDetectorGapCandidates(driftVolumeList, maxDisplacement);
+
+    // A tighter bound, where most pairs are skipped
+    CheckDetectorGapCandidates(driftVolumeList, 0.f);
+  }
+
+  /**
+   *  @brief  Group the TPCs with an all-pairs loop, as was done before the sweep
+   */
+  void GroupTpcsAllPairs(const std::vector<LArPandoraGeometry::TpcSummary>& tpcSummaries,
+                         IndexGroupList& tpcGroups)
+  {
+    const float maxDeltaTheta(0.01f);
+    std::vector<bool> isAssigned(tpcSummaries.size(), false);
+
+    for (unsigned int index1 = 0; index1 < tpcSummaries.size(); ++index1) {
+      if (isAssigned.at(index1)) continue;
+
+      isAssigned.at(index1) = true;
+      const LArPandoraGeometry::TpcSummary& tpc1(tpcSummaries.at(index1));
+      std::vector<unsigned int> tpcGroup(1, index1);
+
+      for (unsigned int index2 = 0; index2 < tpcSummaries.size(); ++index2) {
+        if (isAssigned.at(index2)) continue;
+
+        const LArPandoraGeometry::TpcSummary& tpc2(tpcSummaries.at(index2));
+        if (tpc1.m_driftDirection != tpc2.m_driftDirection) continue;
+
+        const float dThetaU(tpc1.m_wireAngleU - tpc2.m_wireAngleU);
+        const float dThetaV(tpc1.m_wireAngleV - tpc2.m_wireAngleV);
+        const float dThetaW(tpc1.m_wireAngleW - tpc2.m_wireAngleW);
+        if (dThetaU > maxDeltaTheta || dThetaV > maxDeltaTheta || dThetaW > maxDeltaTheta)
+          continue;
+
+        if ((tpc2.m_centralMinX > tpc1.m_centralMaxX) || (tpc1.m_centralMinX > tpc2.m_centralMaxX))
+          continue;
+
+        isAssigned.at(index2) = true;
+        tpcGroup.push_back(index2);
+      }
+
+      tpcGroups.push_back(tpcGroup);
+    }
+  }
+
+  LArPandoraGeometry::TpcSummary MakeTpcSummary(const unsigned int tpc,
+                                                const bool isPositiveDrift,
+                                                const float wireAngleU,
+                                                const float minX,
+                                                const float maxX)
+  {
+    LArPandoraGeometry::TpcSummary tpcSummary;
+    tpcSummary.m_tpc = tpc;
+    tpcSummary.m_isPositiveDrift = isPositiveDrift;
+    tpcSummary.m_driftDirection = (isPositiveDrift ? 1 : -1);
+    tpcSummary.m_wireAngleU = wireAngleU;
+    tpcSummary.m_wireAngleV = -wireAngleU;
+    tpcSummary.m_wireAngleW = 0.f;
+    tpcSummary.m_minX = minX;
+    tpcSummary.m_maxX = maxX;
+    tpcSummary.m_minY = -100.f;
+    tpcSummary.m_maxY = 100.f;
+    tpcSummary.m_minZ = 0.f;
+    tpcSummary.m_maxZ = 200.f;
+    tpcSummary.m_centralMinX = 0.5 * (minX + maxX) - 0.25 * std::fabs(maxX - minX);
+    tpcSummary.m_centralMaxX = 0.5 * (minX + maxX) + 0.25 * std::fabs(maxX - minX);
+    return tpcSummary;
+  }
+
+  void CheckTpcGroups(const std::vector<LArPandoraGeometry::TpcSummary>& tpcSummaries)
+  {
+    IndexGroupList expectedTpcGroups;
+    GroupTpcsAllPairs(tpcSummaries, expectedTpcGroups);
+
+    IndexGroupList tpcGroups;
+    LArPandoraGeometry::GroupTpcs(tpcSummaries, tpcGroups);
+    BOOST_TEST((tpcGroups == expectedTpcGroups));
+  }
+
+} // namespace
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(DetectorGapsLayout)
+{
+  // Alternating drift volumes along X, with a second row along Z and an overlapping volume, listed out of X order
+  LArDriftVolumeList driftVolumeList;
+  driftVolumeList.push_back(MakeDriftVolume(0, 150.f, 0.f, 100.f, 100.f, 200.f, 200.f));
+  driftVolumeList.push_back(MakeDriftVolume(1, -150.f, 0.f, 100.f, 100.f, 200.f, 200.f));
+  driftVolumeList.push_back(MakeDriftVolume(2, 52.f, 0.f, 100.f, 100.f, 200.f, 200.f));
+  driftVolumeList.push_back(MakeDriftVolume(3, -52.f, 0.f, 100.f, 100.f, 200.f, 200.f));
+  driftVolumeList.push_back(MakeDriftVolume(4, 52.f, 0.f, 310.f, 100.f, 200.f, 200.f));
+  driftVolumeList.push_back(MakeDriftVolume(5, -52.f, 0.f, 310.f, 100.f, 200.f, 200.f));
+  driftVolumeList.push_back(MakeDriftVolume(6, 300.f, 5.f, 100.f, 120.f, 180.f, 200.f));
+  driftVolumeList.push_back(MakeDriftVolume(7, 305.f, 0.f, 100.f, 20.f, 20.f, 20.f));
+
+  CheckDetectorGapCandidates(driftVolumeList);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(DetectorGapsRandom)
+{
+  std::mt19937 generator(20231019u);
+  std::uniform_real_distribution<float> centerDistribution(-1000.f, 1000.f);
+  std::uniform_real_distribution<float> offsetDistribution(-40.f, 40.f);
+  std::uniform_real_distribution<float> widthDistribution(5.f, 300.f);
+  std::uniform_int_distribution<unsigned int> sizeDistribution(0u, 60u);
+
+  for (unsigned int iList = 0; iList < 50u; ++iList) {
+    LArDriftVolumeList driftVolumeList;
+    const unsigned int nVolumes(sizeDistribution(generator));
+
+    for (unsigned int iVolume = 0; iVolume < nVolumes; ++iVolume) {
+      // Place some volumes close to an earlier one, so that small gaps and overlaps are common
+      const bool isNearby(!driftVolumeList.empty() && (iVolume % 2));
+      const LArDriftVolume* const pNearby(isNearby ? &driftVolumeList.at(iVolume / 2) : nullptr);
+
+      driftVolumeList.push_back(MakeDriftVolume(
+        iVolume,
+        pNearby ? pNearby->GetCenterX() + pNearby->GetWidthX() + offsetDistribution(generator) :
+                  centerDistribution(generator),
+        pNearby ? pNearby->GetCenterY() + offsetDistribution(generator) :
+                  0.1f * centerDistribution(generator),
+        pNearby ? pNearby->GetCenterZ() + offsetDistribution(generator) :
+                  centerDistribution(generator),
+        widthDistribution(generator),
+        widthDistribution(generator),
+        widthDistribution(generator)));
+    }
+
+    CheckDetectorGapCandidates(driftVolumeList);
+  }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(TpcGroupsLayout)
+{
+  // Two rows of alternating drift directions, a TPC with different wire angles and an empty cryostat
+  std::vector<LArPandoraGeometry::TpcSummary> tpcSummaries;
+  tpcSummaries.push_back(MakeTpcSummary(0, false, 0.6f, -360.f, -2.f));
+  tpcSummaries.push_back(MakeTpcSummary(1, true, 0.6f, 2.f, 360.f));
+  tpcSummaries.push_back(MakeTpcSummary(2, false, 0.6f, -360.f, -2.f));
+  tpcSummaries.push_back(MakeTpcSummary(3, true, 0.6f, 2.f, 360.f));
+  tpcSummaries.push_back(MakeTpcSummary(4, false, 0.6f, 362.f, 720.f));
+  tpcSummaries.push_back(MakeTpcSummary(5, true, 0.6f, -720.f, -362.f));
+  tpcSummaries.push_back(MakeTpcSummary(6, false, -0.6f, -360.f, -2.f));
+  tpcSummaries.push_back(MakeTpcSummary(7, false, 0.6f, -355.f, -10.f));
+
+  CheckTpcGroups(tpcSummaries);
+  CheckTpcGroups(std::vector<LArPandoraGeometry::TpcSummary>());
+
+  IndexGroupList tpcGroups;
+  LArPandoraGeometry::GroupTpcs(tpcSummaries, tpcGroups);
+  BOOST_TEST(tpcGroups.size() == 5u);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(TpcGroupsRandom)
+{
+  std::mt19937 generator(20231019u);
+  std::uniform_real_distribution<float> minXDistribution(-800.f, 800.f);
+  std::uniform_real_distribution<float> widthXDistribution(1.f, 400.f);
+  std::uniform_int_distribution<unsigned int> angleDistribution(0u, 3u);
+  std::uniform_int_distribution<unsigned int> sizeDistribution(0u, 80u);
+  std::bernoulli_distribution driftDistribution(0.5);
+
+  // Wire angles that are equal, within tolerance, or beyond it in either direction
+  const float wireAngles[4] = {0.6f, 0.605f, 0.62f, 0.58f};
+
+  for (unsigned int iCryostat = 0; iCryostat < 100u; ++iCryostat) {
+    std::vector<LArPandoraGeometry::TpcSummary> tpcSummaries;
+    const unsigned int nTpcs(sizeDistribution(generator));
+
+    for (unsigned int iTpc = 0; iTpc < nTpcs; ++iTpc) {
+      const float minX(minXDistribution(generator));
+      tpcSummaries.push_back(MakeTpcSummary(iTpc,
+                                            driftDistribution(generator),
+                                            wireAngles[angleDistribution(generator)],
+                                            minX,
+                                            minX + widthXDistribution(generator)));
+    }
+
+    CheckTpcGroups(tpcSummaries);
+  }
+}